@@ -390,6 +390,10 @@ namespace carl
 		// Orderings
 		///////////////////////////
 
+		/**
+		 * Lexicographic ordering, where greater variables are more significant (as for compareGradedLexical on monomials of degree one).
+		 * Note that lexicalCompare() is only a valid tie breaker for monomials of the same degree and hence not used here.
+		 */
 		static CompareResult compareLexical(const Monomial::Arg& lhs, const Monomial::Arg& rhs)
 		{
 			if( !lhs && !rhs )
@@ -398,15 +402,27 @@ namespace carl
 				return CompareResult::LESS;
 			if( !rhs )
 				return CompareResult::GREATER;
-			return lexicalCompare(*lhs, *rhs);
+			auto lhsit = lhs->mExponents.rbegin();
+			auto rhsit = rhs->mExponents.rbegin();
+			for (; lhsit != lhs->mExponents.rend() && rhsit != rhs->mExponents.rend(); ++lhsit, ++rhsit) {
+				if (lhsit->first != rhsit->first) {
+					return (lhsit->first > rhsit->first) ? CompareResult::GREATER : CompareResult::LESS;
+				}
+				if (lhsit->second != rhsit->second) {
+					return (lhsit->second > rhsit->second) ? CompareResult::GREATER : CompareResult::LESS;
+				}
+			}
+			if (lhsit != lhs->mExponents.rend()) return CompareResult::GREATER;
+			if (rhsit != rhs->mExponents.rend()) return CompareResult::LESS;
+			return CompareResult::EQUAL;
 		}
 		
 		static CompareResult compareLexical(const Monomial::Arg& lhs, Variable rhs)
 		{
 			if(!lhs) return CompareResult::LESS;
-			if(lhs->mExponents.front().first < rhs) return CompareResult::GREATER;
-			if(lhs->mExponents.front().first > rhs) return CompareResult::LESS;
-			if(lhs->mExponents.front().second > 1) return CompareResult::GREATER;
+			if(lhs->mExponents.back().first > rhs) return CompareResult::GREATER;
+			if(lhs->mExponents.back().first < rhs) return CompareResult::LESS;
+			if(lhs->mExponents.back().second > 1 || lhs->mExponents.size() > 1) return CompareResult::GREATER;
 			return CompareResult::EQUAL;
 		}
 
@@ -14,6 +14,7 @@
  #include "MultivariateHornerSettings.h"
 
 #include "Term.h"
+#include "polynomialfunctions/Division.h"
 
 namespace carl{
 
@@ -85,7 +85,8 @@ namespace carl
 	#endif
 
 	//Create Horner Scheme Recursivly
-	MultivariateHorner< PolynomialType, strategy > root (std::move(inPut), true, map);
+	int arithmeticOperationsReductionCounter = 0;
+	MultivariateHorner< PolynomialType, strategy > root (inPut, map, arithmeticOperationsReductionCounter);
 
  	//Part after recursion
  	if (strategy::selectionType == variableSelectionHeurisics::GREEDY_Is || strategy::selectionType == variableSelectionHeurisics::GREEDY_IIs)
@@ -151,9 +152,9 @@ namespace carl
 						if (polynomialIt->has(*variableIt))
 						{
 							Term< typename PolynomialType::CoeffType > currentTerm = *polynomialIt;
-							Term< typename PolynomialType::CoeffType > currentTerm_div = *polynomialIt;
+							Term< typename PolynomialType::CoeffType > currentTerm_div;
 
-							currentTerm_div.divide(*variableIt, currentTerm_div);
+							carl::try_divide(currentTerm, *variableIt, currentTerm_div);
 
 							currentInterval = IntervalEvaluation::evaluate( currentTerm_div, map );
 
@@ -205,7 +206,7 @@ namespace carl
 				{
 					//divide dependent terms by choosen Variable
 
-					polynomialIt->divide(*selectedVariable, tempTerm);
+					carl::try_divide(*polynomialIt, *selectedVariable, tempTerm);
 					counter++;
 					h_dependentPart.addTerm( tempTerm );
 				}
@@ -0,0 +1,176 @@
+/**
+ * @file	MultivariateHornerCache.h
+ */
+
+#pragma once
+
+#include "MultivariateHorner.h"
+#include "../interval/Interval.h"
+#include "../interval/IntervalBox.h"
+
+#include <cmath>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace carl {
+
+/**
+ * Cache of Horner schemes, keyed by polynomial.
+ *
+ * Building a Horner scheme is expensive compared to evaluating it, hence schemes are built once per polynomial and shared by all users.
+ * Callers may either own a cache or use the global one (see getInstance()).
+ * The cache holds at most a fixed number of schemes (see setMaxSize()) and evicts the least recently used scheme if it is full.
+ * The variable selection heuristics GREEDY_II and GREEDY_IIs depend on the intervals of the variables:
+ * for these, the widths of the intervals the scheme was built for are stored and the scheme is only rebuilt
+ * if the width of some variable changed by more than a constant factor (see setThreshold()).
+ * Point intervals are ignored, as schemes are typically evaluated on a box and on points within this box alternately.
+ * Schemes are handed out as shared pointers, hence they stay valid if the cache entry is rebuilt or cleared concurrently.
+ */
+template<typename PolynomialType, class strategy>
+class MultivariateHornerCache {
+public:
+	using Horner = MultivariateHorner<PolynomialType, strategy>;
+
+private:
+	struct Entry {
+		std::shared_ptr<const Horner> scheme;
+		/// The widths the variable selection was based on.
+		std::map<Variable, double> widths;
+		/// Position of the polynomial in mUsage.
+		typename std::list<PolynomialType>::iterator usage;
+	};
+
+	std::unordered_map<PolynomialType, Entry> mEntries;
+	/// Polynomials of all entries, most recently used first.
+	std::list<PolynomialType> mUsage;
+	std::size_t mMaxSize = 1024;
+	double mThreshold = 2;
+	std::size_t mBuilds = 0;
+	std::mutex mMutex;
+
+	static constexpr bool depends_on_intervals() {
+		return strategy::selectionType == variableSelectionHeurisics::GREEDY_II || strategy::selectionType == variableSelectionHeurisics::GREEDY_IIs;
+	}
+
+	/// Interval used for the variable selection if the actual interval is unbounded.
+	static Interval<double> default_interval() {
+#ifdef __VS
+		return Interval<double>(-strategy::targetDiameter(), strategy::targetDiameter());
+#else
+		return Interval<double>(-strategy::targetDiameter, strategy::targetDiameter);
+#endif
+	}
+
+	bool significant(const std::map<Variable, double>& before, const std::map<Variable, double>& after) const {
+		for (const auto& [var, width]: after) {
+			if (width == 0) continue;
+			auto it = before.find(var);
+			if (it == before.end() || it->second == 0) return true;
+			if (width > mThreshold * it->second || it->second > mThreshold * width) return true;
+		}
+		return false;
+	}
+
+	/// Removes the least recently used entries until at most mMaxSize entries are left.
+	void evict() {
+		while (mEntries.size() > mMaxSize) {
+			mEntries.erase(mUsage.back());
+			mUsage.pop_back();
+		}
+	}
+
+public:
+	MultivariateHornerCache() = default;
+	MultivariateHornerCache(const MultivariateHornerCache&) = delete;
+	MultivariateHornerCache& operator=(const MultivariateHornerCache&) = delete;
+
+	/// Returns the global cache.
+	static MultivariateHornerCache& getInstance() {
+		static MultivariateHornerCache cache;
+		return cache;
+	}
+
+	/**
+	 * Returns the Horner scheme of the given polynomial.
+	 * @param p Polynomial.
+	 * @param intervals Intervals of all variables of p, either as a std::map or as an IntervalBox. Only used by interval based variable selection heuristics.
+	 */
+	template<typename Assignment>
+	std::shared_ptr<const Horner> get(const PolynomialType& p, const Assignment& intervals) {
+		std::map<Variable, double> widths;
+		std::map<Variable, Interval<double>> map;
+		if constexpr (depends_on_intervals()) {
+			for (Variable v: carl::variables(p)) {
+				assert(intervals.count(v) > 0);
+				const Interval<double>& i = intervals.at(v);
+				map.emplace(v, i.isUnbounded() ? default_interval() : i);
+				widths.emplace(v, map.at(v).diameter());
+			}
+		}
+		std::lock_guard<std::mutex> lock(mMutex);
+		auto it = mEntries.find(p);
+		if (it != mEntries.end()) {
+			mUsage.splice(mUsage.begin(), mUsage, it->second.usage);
+			if (!significant(it->second.widths, widths)) {
+				return it->second.scheme;
+			}
+		}
+		CARL_LOG_DEBUG("carl.core.horner", "Building Horner scheme for " << p);
+		++mBuilds;
+		std::shared_ptr<const Horner> scheme;
+		if constexpr (depends_on_intervals()) {
+			scheme = std::make_shared<const Horner>(p, map);
+		} else {
+			scheme = std::make_shared<const Horner>(p);
+		}
+		if (it == mEntries.end()) {
+			mUsage.push_front(p);
+			mEntries.emplace(p, Entry{scheme, std::move(widths), mUsage.begin()});
+			evict();
+		} else {
+			it->second.scheme = scheme;
+			it->second.widths = std::move(widths);
+		}
+		return scheme;
+	}
+	/// Returns the Horner scheme of the given polynomial, for variable selection heuristics that do not depend on intervals.
+	std::shared_ptr<const Horner> get(const PolynomialType& p) {
+		static_assert(!depends_on_intervals(), "This variable selection heuristic needs intervals.");
+		return get(p, std::map<Variable, Interval<double>>());
+	}
+
+	/// Sets the factor by which the width of an interval has to change such that the Horner scheme is rebuilt.
+	void setThreshold(double threshold) {
+		assert(threshold >= 1);
+		std::lock_guard<std::mutex> lock(mMutex);
+		mThreshold = threshold;
+	}
+
+	/// Sets the maximal number of Horner schemes in the cache, evicting the least recently used ones if necessary.
+	void setMaxSize(std::size_t size) {
+		assert(size > 0);
+		std::lock_guard<std::mutex> lock(mMutex);
+		mMaxSize = size;
+		evict();
+	}
+
+	/// Returns the number of Horner schemes that have been built.
+	std::size_t builds() {
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mBuilds;
+	}
+	std::size_t size() {
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mEntries.size();
+	}
+	void clear() {
+		std::lock_guard<std::mutex> lock(mMutex);
+		mEntries.clear();
+		mUsage.clear();
+	}
+};
+
+}
@@ -287,7 +287,11 @@ std::size_t MultivariatePolynomial<Coeff,Ordering,Policies>::totalDegree() const
 	if (Ordering::degreeOrder) {
 		return this->lterm().tdeg();
 	} else {
-		CARL_LOG_NOTIMPLEMENTED();
+		std::size_t max = 0;
+		for (const auto& t: mTerms) {
+			max = std::max(max, std::size_t(t.tdeg()));
+		}
+		return max;
 	}
 }
 
@@ -0,0 +1,214 @@
+#pragma once
+
+#include "../UnivariatePolynomial.h"
+#include "../logging.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <vector>
+
+namespace carl {
+namespace roots {
+namespace aberth {
+
+/**
+ * An approximation of a complex root together with an inclusion radius.
+ *
+ * The radius is an estimate for the distance to the closest root:
+ * the union of all discs around the approximations contains all roots,
+ * and every connected component of the union that consists of m discs contains exactly m roots, counted with multiplicity.
+ * As the radii are computed in floating point arithmetic, this is not a proof and results have to be confirmed exactly.
+ */
+template<typename Float>
+struct RootApproximation {
+	std::complex<Float> value;
+	Float radius;
+};
+
+namespace detail_aberth {
+
+/// Returns the binary exponent of the magnitude of n, i.e. 2^(e-2) < |n| < 2^(e+1) for the result e.
+template<typename Number>
+long exponent(const Number& n) {
+	return long(carl::bitsize(carl::getNum(n))) - long(carl::bitsize(carl::getDenom(n)));
+}
+
+/// Converts n * 2^(-shift) to Float, where n itself may be out of the range of doubles.
+template<typename Float, typename Number>
+Float convert(const Number& n, long shift) {
+	if (carl::isZero(n)) return Float(0);
+	long e = exponent(n);
+	Number factor = carl::pow(Number(2), uint(std::abs(e)));
+	Number scaled = e >= 0 ? Number(n / factor) : Number(n * factor);
+	// Convert as a sum of two doubles, such that Float may be more precise than double.
+	double high = carl::toDouble(scaled);
+	double low = carl::toDouble(Number(scaled - carl::rationalize<Number>(high)));
+	return std::ldexp(Float(high) + Float(low), int(e - shift));
+}
+
+/**
+ * Evaluates the polynomial with the given coefficients at z.
+ * @return The value p(z), its Newton correction p(z)/p'(z) and a bound on the rounding errors of p(z) (up to a factor of machine precision).
+ * If |z| > 1, the value is scaled by z^-n and computed from the reversed polynomial to avoid overflows.
+ */
+template<typename Float>
+void evaluate(const std::vector<Float>& coeffs, const std::complex<Float>& z, std::complex<Float>& value, std::complex<Float>& correction, Float& error) {
+	using Complex = std::complex<Float>;
+	std::size_t n = coeffs.size() - 1;
+	if (std::abs(z) <= Float(1)) {
+		Complex p = coeffs[n];
+		Complex dp = Float(0);
+		Float err = std::abs(coeffs[n]);
+		Float az = std::abs(z);
+		for (std::size_t i = n; i-- > 0;) {
+			dp = dp * z + p;
+			p = p * z + coeffs[i];
+			err = err * az + std::abs(coeffs[i]);
+		}
+		value = p;
+		correction = p / dp;
+		error = err;
+	} else {
+		// p(z) = z^n q(w) with w = 1/z and q the reversed polynomial, p'(z) = z^(n-1) (n q(w) - w q'(w))
+		Complex w = Float(1) / z;
+		Complex q = coeffs[0];
+		Complex dq = Float(0);
+		Float err = std::abs(coeffs[0]);
+		Float aw = std::abs(w);
+		for (std::size_t i = 1; i <= n; ++i) {
+			dq = dq * w + q;
+			q = q * w + coeffs[i];
+			err = err * aw + std::abs(coeffs[i]);
+		}
+		value = q;
+		correction = z * q / (Float(n) * q - w * dq);
+		error = err;
+	}
+}
+
+/**
+ * Initial approximations due to Bini: the roots are placed on circles whose radii are obtained from
+ * the upper convex hull of the points (i, log|a_i|), which yields good estimates for the moduli of the roots.
+ */
+template<typename Float>
+std::vector<std::complex<Float>> initial_approximations(const std::vector<Float>& coeffs) {
+	std::size_t n = coeffs.size() - 1;
+	std::vector<std::pair<Float, Float>> points;
+	for (std::size_t i = 0; i <= n; ++i) {
+		if (coeffs[i] == Float(0)) continue;
+		std::pair<Float, Float> p(Float(i), std::log(std::abs(coeffs[i])));
+		while (points.size() >= 2) {
+			const auto& a = points[points.size() - 2];
+			const auto& b = points.back();
+			// Remove b if it is not strictly above the segment from a to p.
+			if ((b.first - a.first) * (p.second - a.second) - (b.second - a.second) * (p.first - a.first) < Float(0)) break;
+			points.pop_back();
+		}
+		points.push_back(p);
+	}
+	const Float pi = std::acos(Float(-1));
+	const Float sigma = Float(0.7);
+	std::vector<std::complex<Float>> res;
+	for (std::size_t k = 1; k < points.size(); ++k) {
+		std::size_t lower = std::size_t(points[k-1].first);
+		std::size_t upper = std::size_t(points[k].first);
+		std::size_t count = upper - lower;
+		Float radius = std::exp((points[k-1].second - points[k].second) / Float(count));
+		for (std::size_t j = 0; j < count; ++j) {
+			Float angle = Float(2) * pi * (Float(j) / Float(count) + Float(lower) / Float(n)) + sigma;
+			res.push_back(std::polar(radius, angle));
+		}
+	}
+	// Zero coefficients at the lowest degrees correspond to zero roots.
+	while (res.size() < n) res.emplace_back(Float(0));
+	return res;
+}
+
+}
+
+/**
+ * Computes approximations of all complex roots of p by the Aberth-Ehrlich iteration.
+ *
+ * The coefficients are scaled by a power of two and converted to Float such that large coefficients do not overflow.
+ * Iterations on approximations with a modulus larger than one are done on the reversed polynomial, hence the iteration works for large degrees as well.
+ * After the iteration, an inclusion radius is computed for every approximation,
+ * based on the Gerschgorin-type bound n |p(z_i)| / |a_n prod_{j != i} (z_i - z_j)| by Braess and Hadeler,
+ * enlarged by an estimate of the rounding errors within the evaluation of p.
+ * @param p Polynomial with rational coefficients.
+ * @param max_iterations Maximal number of Aberth-Ehrlich steps.
+ * @return Approximations with inclusion radii, empty if p is constant.
+ */
+template<typename Float = long double, typename Number>
+std::vector<RootApproximation<Float>> root_approximation(const UnivariatePolynomial<Number>& p, std::size_t max_iterations = 200) {
+	using Complex = std::complex<Float>;
+	if (p.degree() == 0) return {};
+	std::size_t n = p.degree();
+	long shift = std::numeric_limits<long>::min();
+	for (const auto& c: p.coefficients()) {
+		if (!carl::isZero(c)) shift = std::max(shift, detail_aberth::exponent(c));
+	}
+	std::vector<Float> coeffs;
+	for (const auto& c: p.coefficients()) {
+		coeffs.push_back(detail_aberth::convert<Float>(c, shift));
+	}
+
+	std::vector<Complex> z = detail_aberth::initial_approximations(coeffs);
+	std::vector<bool> converged(n, false);
+	const Float eps = std::numeric_limits<Float>::epsilon();
+	std::size_t iteration = 0;
+	for (; iteration < max_iterations; ++iteration) {
+		bool done = true;
+		for (std::size_t i = 0; i < n; ++i) {
+			if (converged[i]) continue;
+			Complex value, correction;
+			Float error;
+			detail_aberth::evaluate(coeffs, z[i], value, correction, error);
+			if (value == Complex(0) || !std::isfinite(std::abs(correction))) {
+				converged[i] = true;
+				continue;
+			}
+			Complex sum = Float(0);
+			for (std::size_t j = 0; j < n; ++j) {
+				if (j != i) sum += Float(1) / (z[i] - z[j]);
+			}
+			Complex step = correction / (Float(1) - correction * sum);
+			if (!std::isfinite(std::abs(step))) {
+				converged[i] = true;
+				continue;
+			}
+			z[i] -= step;
+			// The value is dominated by rounding errors, further steps do not improve the approximation.
+			if (std::abs(step) <= eps * std::abs(z[i]) || std::abs(value) <= Float(4 * n) * eps * error) {
+				converged[i] = true;
+			}
+			done = done && converged[i];
+		}
+		if (done) break;
+	}
+	CARL_LOG_DEBUG("carl.core.aberth", "Aberth iteration for degree " << n << " stopped after " << iteration << " iterations");
+
+	std::vector<RootApproximation<Float>> res;
+	Float log_lead = std::log(std::abs(coeffs[n]));
+	for (std::size_t i = 0; i < n; ++i) {
+		Complex value, correction;
+		Float error;
+		detail_aberth::evaluate(coeffs, z[i], value, correction, error);
+		// Everything is done in logarithms, as the product easily leaves the range of Float.
+		Float residual = std::abs(value) + Float(2 * n + 1) * eps * error;
+		Float log_radius = std::log(Float(n)) + std::log(residual) - log_lead;
+		if (std::abs(z[i]) > Float(1)) log_radius += Float(n) * std::log(std::abs(z[i]));
+		for (std::size_t j = 0; j < n; ++j) {
+			if (j != i) log_radius -= std::log(std::abs(z[i] - z[j]));
+		}
+		Float radius = std::exp(log_radius);
+		if (std::isnan(radius)) radius = std::numeric_limits<Float>::infinity();
+		res.push_back(RootApproximation<Float>{z[i], radius});
+	}
+	return res;
+}
+
+}
+}
+}
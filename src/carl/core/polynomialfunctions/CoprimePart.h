@@ -1,7 +1,15 @@
 #pragma once
 
+#include "Division.h"
+#include "GCD_univariate.h"
+#include "SquareFreePart.h"
+
 #include "../../converter/CoCoAAdaptor.h"
 #include "../logging.h"
+#include "../UnivariatePolynomial.h"
+
+#include <utility>
+#include <vector>
 
 namespace carl {
 
@@ -34,4 +42,47 @@ MultivariatePolynomial<C,O,P> coprimePart(const MultivariatePolynomial<C,O,P>& p
 	return s(p, q);
 }
 
+/**
+ * Computes a coprime basis of the square-free parts of the given univariate polynomials by gcd-based factor refinement.
+ * The resulting polynomials are square-free, non-constant and pairwise coprime,
+ * and every input polynomial (except zero) equals a product of some of them, up to multiplicities and a constant factor.
+ * Thus, every real root of some input polynomial is a root of exactly one basis element.
+ * @param polys Univariate polynomials in the same variable.
+ * @return Pairs of a basis element and the (sorted) indices of the input polynomials it divides.
+ */
+template<typename Coeff, EnableIf<is_subset_of_rationals<Coeff>> = dummy>
+std::vector<std::pair<UnivariatePolynomial<Coeff>, std::vector<std::size_t>>> coprime_basis(const std::vector<UnivariatePolynomial<Coeff>>& polys) {
+	std::vector<std::pair<UnivariatePolynomial<Coeff>, std::vector<std::size_t>>> basis;
+	for (std::size_t i = 0; i < polys.size(); ++i) {
+		if (carl::isZero(polys[i]) || polys[i].isConstant()) continue;
+		UnivariatePolynomial<Coeff> f = carl::squareFreePart(polys[i]);
+		std::vector<std::pair<UnivariatePolynomial<Coeff>, std::vector<std::size_t>>> next;
+		for (auto& [b, origins]: basis) {
+			if (f.isConstant()) {
+				next.emplace_back(std::move(b), std::move(origins));
+				continue;
+			}
+			UnivariatePolynomial<Coeff> g = carl::gcd(f, b);
+			if (g.isConstant()) {
+				next.emplace_back(std::move(b), std::move(origins));
+				continue;
+			}
+			// b = g * (b/g) with coprime factors as b is square-free, and f/g is coprime to b.
+			f = carl::divide(f, g).quotient;
+			UnivariatePolynomial<Coeff> rest = carl::divide(b, g).quotient;
+			if (!rest.isConstant()) {
+				next.emplace_back(std::move(rest), origins);
+			}
+			origins.push_back(i);
+			next.emplace_back(std::move(g), std::move(origins));
+		}
+		if (!f.isConstant()) {
+			next.emplace_back(std::move(f), std::vector<std::size_t>({i}));
+		}
+		basis = std::move(next);
+	}
+	CARL_LOG_DEBUG("carl.core.coprimepart", "Coprime basis of " << polys.size() << " polynomials has " << basis.size() << " elements");
+	return basis;
+}
+
 }
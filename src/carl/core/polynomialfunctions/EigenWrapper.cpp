@@ -3,6 +3,7 @@
 #include <eigen3/Eigen/Dense>
 #include <eigen3/Eigen/Eigenvalues>
 
+#include <cassert>
 #include <cmath>
 #include <vector>
 
@@ -41,3 +42,31 @@ std::vector<double> root_approximation(const std::vector<double>& coeffs) {
 }
 }
 }
+
+namespace carl {
+namespace eigen {
+
+std::vector<double> inverse(const std::vector<double>& matrix, std::size_t n) {
+	using Index = Eigen::MatrixXd::Index;
+	assert(matrix.size() == n * n);
+	Eigen::MatrixXd m = Eigen::MatrixXd::Zero(Index(n), Index(n));
+	for (std::size_t i = 0; i < n; ++i) {
+		for (std::size_t j = 0; j < n; ++j) {
+			m(Index(i), Index(j)) = matrix[i * n + j];
+		}
+	}
+	Eigen::FullPivLU<Eigen::MatrixXd> lu(m);
+	if (!lu.isInvertible()) return {};
+	Eigen::MatrixXd inv = lu.inverse();
+	std::vector<double> res(n * n);
+	for (std::size_t i = 0; i < n; ++i) {
+		for (std::size_t j = 0; j < n; ++j) {
+			if (!std::isfinite(inv(Index(i), Index(j)))) return {};
+			res[i * n + j] = inv(Index(i), Index(j));
+		}
+	}
+	return res;
+}
+
+}
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <vector>
 
 namespace carl {
@@ -15,3 +16,15 @@ std::vector<double> root_approximation(const std::vector<double>& coeffs);
 }
 }
 }
+
+namespace carl {
+namespace eigen {
+
+/**
+ * Compute an approximate inverse of the given square matrix of dimension n, stored row by row.
+ * Returns an empty vector if the matrix is (numerically) singular.
+ */
+std::vector<double> inverse(const std::vector<double>& matrix, std::size_t n);
+
+}
+}
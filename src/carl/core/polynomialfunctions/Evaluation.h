@@ -63,4 +63,34 @@ bool is_root_of(const UnivariatePolynomial<Coeff>& p, const Coeff& value) {
 	return carl::sgn(carl::evaluate(p, value)) == Sign::ZERO;
 }
 
+/**
+ * Computes the sign of a polynomial with integer coefficients at num / den, where den is positive.
+ * Only integer arithmetic is used, as the sign equals the sign of den^n * p(num / den) = sum_i c_i * num^i * den^(n-i).
+ * If den is a power of two, that is num / den is a dyadic rational, the powers of den are applied as binary shifts.
+ * @param coeffs Coefficients ordered by increasing degree.
+ * @param num Numerator of the point.
+ * @param den Positive denominator of the point.
+ * @return Sign of the polynomial at num / den.
+ */
+template<typename Integer>
+Sign sgn_at(const std::vector<Integer>& coeffs, const Integer& num, const Integer& den) {
+	assert(carl::sgn(den) == Sign::POSITIVE);
+	if (coeffs.empty()) return Sign::ZERO;
+	std::size_t exponent = carl::bitsize(den) - 1;
+	bool dyadic = den == (carl::constant_one<Integer>::get() << exponent);
+	Integer result = coeffs.back();
+	Integer factor = den;
+	std::size_t shift = exponent;
+	for (std::size_t i = coeffs.size() - 1; i-- > 0;) {
+		result *= num;
+		if (!carl::isZero(coeffs[i])) {
+			if (dyadic) result += coeffs[i] << shift;
+			else result += coeffs[i] * factor;
+		}
+		if (dyadic) shift += exponent;
+		else factor *= den;
+	}
+	return carl::sgn(result);
+}
+
 }
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "../UnivariatePolynomial.h"
+
+#include <vector>
+
+namespace carl {
+
+namespace detail_taylor_shift {
+
+/// Below this size, coefficient vectors are multiplied by the schoolbook method.
+constexpr std::size_t karatsuba_threshold = 32;
+/// Below this size, polynomials are shifted by the classical quadratic method.
+constexpr std::size_t divide_and_conquer_threshold = 64;
+
+template<typename Coeff>
+void add_to(std::vector<Coeff>& lhs, const std::vector<Coeff>& rhs, std::size_t offset) {
+	if (lhs.size() < rhs.size() + offset) lhs.resize(rhs.size() + offset, constant_zero<Coeff>::get());
+	for (std::size_t i = 0; i < rhs.size(); ++i) {
+		lhs[i + offset] += rhs[i];
+	}
+}
+
+/**
+ * Multiplies two dense coefficient vectors using Karatsuba's method.
+ * @complexity O(n^1.58) coefficient operations
+ */
+template<typename Coeff>
+std::vector<Coeff> multiply(const std::vector<Coeff>& f, const std::vector<Coeff>& g) {
+	if (f.empty() || g.empty()) return {};
+	if (f.size() < karatsuba_threshold || g.size() < karatsuba_threshold) {
+		std::vector<Coeff> res(f.size() + g.size() - 1, constant_zero<Coeff>::get());
+		for (std::size_t i = 0; i < f.size(); ++i) {
+			if (carl::isZero(f[i])) continue;
+			for (std::size_t j = 0; j < g.size(); ++j) {
+				res[i + j] += f[i] * g[j];
+			}
+		}
+		return res;
+	}
+	std::size_t half = std::max(f.size(), g.size()) / 2;
+	if (f.size() <= half || g.size() <= half) {
+		// Unbalanced operands: split only the larger one.
+		const auto& large = f.size() > g.size() ? f : g;
+		const auto& small = f.size() > g.size() ? g : f;
+		std::vector<Coeff> low(large.begin(), large.begin() + long(half));
+		std::vector<Coeff> high(large.begin() + long(half), large.end());
+		std::vector<Coeff> res = multiply(low, small);
+		add_to(res, multiply(high, small), half);
+		return res;
+	}
+	std::vector<Coeff> f0(f.begin(), f.begin() + long(half));
+	std::vector<Coeff> f1(f.begin() + long(half), f.end());
+	std::vector<Coeff> g0(g.begin(), g.begin() + long(half));
+	std::vector<Coeff> g1(g.begin() + long(half), g.end());
+	std::vector<Coeff> low = multiply(f0, g0);
+	std::vector<Coeff> high = multiply(f1, g1);
+	add_to(f0, f1, 0);
+	add_to(g0, g1, 0);
+	std::vector<Coeff> mid = multiply(f0, g0);
+	for (std::size_t i = 0; i < low.size(); ++i) mid[i] -= low[i];
+	for (std::size_t i = 0; i < high.size(); ++i) mid[i] -= high[i];
+
+	std::vector<Coeff> res = std::move(low);
+	add_to(res, mid, half);
+	add_to(res, high, 2 * half);
+	res.resize(f.size() + g.size() - 1);
+	return res;
+}
+
+/**
+ * Applies x -> x + 1 by repeated synthetic division.
+ * @complexity O(n^2) additions
+ */
+template<typename Coeff>
+void shift_by_one_classical(std::vector<Coeff>& coeffs) {
+	if (coeffs.size() < 2) return;
+	std::size_t n = coeffs.size() - 1;
+	for (std::size_t i = 0; i < n; ++i) {
+		for (std::size_t j = n; j-- > i;) {
+			coeffs[j] += coeffs[j + 1];
+		}
+	}
+}
+
+/**
+ * Applies x -> x + 1 by splitting p = p0 + x^m p1 with m a power of two,
+ * such that p(x+1) = p0(x+1) + (x+1)^m p1(x+1).
+ * @param binomials Cache of (x+1)^(2^k), indexed by k.
+ * @complexity O(M(n) log(n)) where M(n) is the complexity of multiplication
+ */
+template<typename Coeff>
+void shift_by_one_divide_and_conquer(std::vector<Coeff>& coeffs, std::vector<std::vector<Coeff>>& binomials) {
+	if (coeffs.size() < divide_and_conquer_threshold) {
+		shift_by_one_classical(coeffs);
+		return;
+	}
+	std::size_t k = 0;
+	while ((std::size_t(2) << k) < coeffs.size()) ++k;
+	std::size_t m = std::size_t(1) << k;
+	while (binomials.size() <= k) {
+		std::size_t e = std::size_t(1) << binomials.size();
+		std::vector<Coeff> b(e + 1);
+		b[0] = constant_one<Coeff>::get();
+		for (std::size_t i = 0; i < e; ++i) {
+			b[i + 1] = b[i] * Coeff(e - i) / Coeff(i + 1);
+		}
+		binomials.emplace_back(std::move(b));
+	}
+	std::vector<Coeff> high(coeffs.begin() + long(m), coeffs.end());
+	coeffs.resize(m);
+	shift_by_one_divide_and_conquer(coeffs, binomials);
+	shift_by_one_divide_and_conquer(high, binomials);
+	add_to(coeffs, multiply(binomials[k], high), 0);
+}
+
+}
+
+/**
+ * Applies the Taylor shift x -> x + 1 to a dense coefficient vector, ordered by increasing degree.
+ * Small polynomials are shifted classically, larger ones by a divide and conquer scheme based on fast multiplication.
+ * @param coeffs Coefficients of the polynomial, modified in place.
+ */
+template<typename Coeff>
+void taylor_shift_by_one(std::vector<Coeff>& coeffs) {
+	std::vector<std::vector<Coeff>> binomials;
+	detail_taylor_shift::shift_by_one_divide_and_conquer(coeffs, binomials);
+}
+
+/**
+ * Computes p(x + a).
+ * For a != 1, the shift is reduced to a shift by one via p(x + a) = q(x/a + 1) with q(x) = p(a*x).
+ * @param p A polynomial.
+ * @param a Offset to shift x.
+ * @return p(x + a)
+ */
+template<typename Coeff>
+UnivariatePolynomial<Coeff> taylor_shift(const UnivariatePolynomial<Coeff>& p, const Coeff& a) {
+	if (carl::isZero(a)) return p;
+	std::vector<Coeff> coeffs = p.coefficients();
+	bool scale = !carl::isOne(a);
+	if (scale) {
+		Coeff factor = a;
+		for (std::size_t i = 1; i < coeffs.size(); ++i) {
+			coeffs[i] *= factor;
+			factor *= a;
+		}
+	}
+	taylor_shift_by_one(coeffs);
+	if (scale) {
+		Coeff factor = a;
+		for (std::size_t i = 1; i < coeffs.size(); ++i) {
+			coeffs[i] /= factor;
+			factor *= a;
+		}
+	}
+	return UnivariatePolynomial<Coeff>(p.mainVar(), std::move(coeffs));
+}
+
+}
@@ -0,0 +1,306 @@
+/**
+ * @file FGLM.h
+ * @ingroup gb
+ *
+ * Conversion of Groebner bases of zero-dimensional ideals between monomial orderings
+ * as described in @cite FGLM93 .
+ */
+
+#pragma once
+
+#include "Ideal.h"
+#include "Reductor.h"
+#include "../core/MultivariatePolynomial.h"
+#include "../core/Variables.h"
+#include "../core/logging.h"
+
+#include <algorithm>
+#include <cassert>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Converts the reduced Groebner basis of a zero-dimensional ideal to the reduced Groebner basis of the same ideal
+ * with respect to the ordering of TargetPolynomial, typically from GrLexOrdering to LexOrdering.
+ *
+ * The quotient ring is a finite-dimensional vector space whose basis consists of the standard monomials,
+ * that is all monomials which are not divisible by a leading monomial of the input basis.
+ * Elements of the quotient ring are stored as sparse vectors with respect to this basis.
+ * The multiplication matrices for every variable are built lazily, column by column,
+ * such that the normal form of a monomial is obtained from the normal form of its predecessor by a sparse matrix-vector product.
+ * The monomials are then enumerated in increasing target ordering and checked for linear dependence
+ * by an incremental gaussian elimination.
+ *
+ * The input is expected to be a reduced Groebner basis with monic generators as computed by GBProcedure.
+ * @ingroup gb
+ */
+template<typename Polynomial, typename TargetPolynomial>
+class FGLM
+{
+public:
+	using Coeff = typename Polynomial::CoeffType;
+	/// A sparse vector in the quotient ring, mapping indices of standard monomials to coefficients.
+	using Vector = std::map<std::size_t, Coeff>;
+
+private:
+	using TargetOrdering = typename TargetPolynomial::OrderedBy;
+
+	/// A row of the echelon form, with pivot coefficient one.
+	struct Row
+	{
+		std::size_t mPivot;
+		Vector mValues;
+		/// The row as a linear combination of the monomials in the new staircase.
+		Vector mCombination;
+	};
+
+	const Ideal<Polynomial>& mGb;
+	std::vector<Variable> mVariables;
+	bool mZeroDimensional;
+	/// The standard monomials of the input basis.
+	std::vector<Monomial::Arg> mStandardMonomials;
+	std::unordered_map<Monomial::Arg, std::size_t> mIndices;
+	/// The columns of the multiplication matrices, indexed by variable and standard monomial.
+	std::vector<std::vector<std::optional<Vector>>> mMultiplication;
+
+public:
+	/**
+	 * @param gb Reduced Groebner basis, must outlive this object.
+	 */
+	explicit FGLM(const Ideal<Polynomial>& gb):
+		mGb(gb),
+		mVariables(),
+		mZeroDimensional(true),
+		mStandardMonomials(),
+		mIndices(),
+		mMultiplication()
+	{
+		carlVariables vars;
+		for(const auto& g: mGb.getGenerators())
+		{
+			carl::variables(g, vars);
+		}
+		mVariables = vars.as_vector();
+		for(Variable v: mVariables)
+		{
+			bool pure = std::any_of(mGb.getGenerators().begin(), mGb.getGenerators().end(), [v](const Polynomial& g) {
+				return g.lmon() && g.lmon()->exponents().size() == 1 && g.lmon()->exponents().front().first == v;
+			});
+			if(!pure) mZeroDimensional = false;
+		}
+		if(mZeroDimensional)
+		{
+			computeStandardMonomials();
+			mMultiplication.assign(mVariables.size(), std::vector<std::optional<Vector>>(mStandardMonomials.size()));
+		}
+	}
+
+	/**
+	 * @return If the ideal is zero-dimensional, that is the quotient ring has finite dimension.
+	 */
+	bool isZeroDimensional() const
+	{
+		return mZeroDimensional;
+	}
+
+	/**
+	 * @return The dimension of the quotient ring, which is the number of complex solutions counted with multiplicity.
+	 */
+	std::size_t dimension() const
+	{
+		assert(mZeroDimensional);
+		return mStandardMonomials.size();
+	}
+
+	/**
+	 * @return The standard monomials of the input basis.
+	 */
+	const std::vector<Monomial::Arg>& standardMonomials() const
+	{
+		return mStandardMonomials;
+	}
+
+	/**
+	 * @return The reduced Groebner basis with respect to the target ordering, sorted by increasing leading monomials.
+	 */
+	std::vector<TargetPolynomial> convert();
+
+private:
+	static bool divides(const Monomial::Arg& divisor, const Monomial::Arg& m)
+	{
+		if(!divisor) return true;
+		if(!m) return false;
+		return m->divisible(divisor);
+	}
+
+	bool isStandard(const Monomial::Arg& m) const
+	{
+		return std::none_of(mGb.getGenerators().begin(), mGb.getGenerators().end(), [&m](const Polynomial& g) {
+			return divides(g.lmon(), m);
+		});
+	}
+
+	static void addScaled(Vector& lhs, const Vector& rhs, const Coeff& factor)
+	{
+		for(const auto& entry: rhs)
+		{
+			auto it = lhs.emplace(entry.first, constant_zero<Coeff>::get()).first;
+			it->second += factor * entry.second;
+			if(carl::isZero(it->second)) lhs.erase(it);
+		}
+	}
+
+	void computeStandardMonomials();
+	/// The normal form of the product of a variable and a standard monomial.
+	const Vector& column(std::size_t variable, std::size_t index);
+	/// The normal form of the product of a variable and an element of the quotient ring.
+	Vector multiply(std::size_t variable, const Vector& v);
+};
+
+template<typename Polynomial, typename TargetPolynomial>
+void FGLM<Polynomial, TargetPolynomial>::computeStandardMonomials()
+{
+	if(!isStandard(nullptr)) return;
+	mStandardMonomials.push_back(nullptr);
+	mIndices.emplace(nullptr, 0);
+	for(std::size_t i = 0; i < mStandardMonomials.size(); ++i)
+	{
+		for(Variable v: mVariables)
+		{
+			Monomial::Arg m = mStandardMonomials[i] * createMonomial(v, 1);
+			if(mIndices.find(m) != mIndices.end() || !isStandard(m)) continue;
+			mIndices.emplace(m, mStandardMonomials.size());
+			mStandardMonomials.push_back(m);
+		}
+	}
+}
+
+template<typename Polynomial, typename TargetPolynomial>
+const typename FGLM<Polynomial, TargetPolynomial>::Vector& FGLM<Polynomial, TargetPolynomial>::column(std::size_t variable, std::size_t index)
+{
+	std::optional<Vector>& res = mMultiplication[variable][index];
+	if(!res)
+	{
+		Monomial::Arg m = mStandardMonomials[index] * createMonomial(mVariables[variable], 1);
+		res = Vector();
+		auto it = mIndices.find(m);
+		if(it != mIndices.end())
+		{
+			res->emplace(it->second, constant_one<Coeff>::get());
+		}
+		else
+		{
+			Reductor<Polynomial, Polynomial> reductor(mGb, Polynomial(Term<Coeff>(constant_one<Coeff>::get(), m)));
+			Polynomial nf = reductor.fullReduce();
+			for(const auto& t: nf)
+			{
+				assert(mIndices.find(t.monomial()) != mIndices.end());
+				res->emplace(mIndices.at(t.monomial()), t.coeff());
+			}
+		}
+	}
+	return *res;
+}
+
+template<typename Polynomial, typename TargetPolynomial>
+typename FGLM<Polynomial, TargetPolynomial>::Vector FGLM<Polynomial, TargetPolynomial>::multiply(std::size_t variable, const Vector& v)
+{
+	Vector res;
+	for(const auto& entry: v)
+	{
+		addScaled(res, column(variable, entry.first), entry.second);
+	}
+	return res;
+}
+
+template<typename Polynomial, typename TargetPolynomial>
+std::vector<TargetPolynomial> FGLM<Polynomial, TargetPolynomial>::convert()
+{
+	assert(mZeroDimensional);
+	std::vector<TargetPolynomial> result;
+	if(mStandardMonomials.empty())
+	{
+		// The ideal contains one.
+		result.emplace_back(constant_one<Coeff>::get());
+		return result;
+	}
+	// The staircase with respect to the target ordering.
+	std::vector<Monomial::Arg> staircase;
+	std::vector<Row> rows;
+	// Monomials to be checked, with their normal forms.
+	std::map<Monomial::Arg, Vector, TargetOrdering> candidates;
+	candidates.emplace(nullptr, Vector({{mIndices.at(nullptr), constant_one<Coeff>::get()}}));
+
+	while(!candidates.empty())
+	{
+		Monomial::Arg m = candidates.begin()->first;
+		Vector values = std::move(candidates.begin()->second);
+		candidates.erase(candidates.begin());
+		bool isMultiple = std::any_of(result.begin(), result.end(), [&m](const TargetPolynomial& g) {
+			return divides(g.lmon(), m);
+		});
+		if(isMultiple) continue;
+
+		// The normal form of m, the normal forms of its successors are computed from it.
+		Vector nf = values;
+		// Reduce by the rows found so far, the candidate itself has index staircase.size() in the combination.
+		Vector combination({{staircase.size(), constant_one<Coeff>::get()}});
+		for(const Row& row: rows)
+		{
+			auto it = values.find(row.mPivot);
+			if(it == values.end()) continue;
+			Coeff factor = -it->second;
+			addScaled(values, row.mValues, factor);
+			addScaled(combination, row.mCombination, factor);
+		}
+
+		if(values.empty())
+		{
+			// m is a linear combination of smaller standard monomials, which yields a new element of the basis.
+			TargetPolynomial g;
+			for(const auto& entry: combination)
+			{
+				const Monomial::Arg& mon = entry.first < staircase.size() ? staircase[entry.first] : m;
+				g += Term<Coeff>(entry.second, mon);
+			}
+			CARL_LOG_DEBUG("carl.gb.fglm", "New basis element " << g);
+			result.push_back(std::move(g));
+			continue;
+		}
+
+		// m is a new standard monomial with respect to the target ordering.
+		std::size_t pivot = values.begin()->first;
+		Coeff inverse = constant_one<Coeff>::get() / values.begin()->second;
+		for(auto& entry: values) entry.second *= inverse;
+		for(auto& entry: combination) entry.second *= inverse;
+		rows.push_back(Row{pivot, std::move(values), std::move(combination)});
+		staircase.push_back(m);
+
+		for(std::size_t v = 0; v < mVariables.size(); ++v)
+		{
+			Monomial::Arg next = m * createMonomial(mVariables[v], 1);
+			if(candidates.find(next) != candidates.end()) continue;
+			candidates.emplace(next, multiply(v, nf));
+		}
+	}
+	assert(staircase.size() == mStandardMonomials.size());
+	return result;
+}
+
+/**
+ * Converts a reduced Groebner basis of a zero-dimensional ideal to the ordering of TargetPolynomial.
+ * @param gb Reduced Groebner basis.
+ * @return The reduced Groebner basis with respect to the new ordering.
+ */
+template<typename TargetPolynomial, typename Polynomial>
+std::vector<TargetPolynomial> fglm(const Ideal<Polynomial>& gb)
+{
+	return FGLM<Polynomial, TargetPolynomial>(gb).convert();
+}
+
+}
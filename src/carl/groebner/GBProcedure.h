@@ -8,9 +8,15 @@
 #pragma once
 #include "Ideal.h"
 #include "Reductor.h"
+#include "gb-buchberger/SPolPair.h"
 #include "../core/logging.h"
 #include "../util/BitVector.h"
 
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <utility>
+
 namespace carl
 {
 
@@ -21,6 +27,8 @@ class AbstractGBProcedure
 	virtual ~AbstractGBProcedure() = default;
 	virtual void addPolynomial(const Polynomial& p) = 0;
 	virtual void reset()= 0;
+	virtual void push()= 0;
+	virtual void pop()= 0;
 	virtual void calculate()= 0;
 	
 	
@@ -38,7 +46,9 @@ class AbstractGBProcedure
  * Therefore, it holds a queue with the polynomials which are added. 
  * Only upon calling the calculate method, these polynoimials are added to the actual groebner basis.
  * 
- * Moreover, we can 
+ * Moreover, we can save the current state with push() and return to it with pop().
+ * Saving a state does not copy the basis: the basis of a saved state is only extended temporarily
+ * during the next calculate() and truncated to its previous size afterwards.
  * @ingroup gb 
  */
 template<typename Polynomial, template<typename, template<typename> class > class Procedure, template<typename> class AddingPolynomialPolicy>
@@ -54,6 +64,47 @@ private:
 	/// Indices of the input polynomials.
 	std::vector<size_t> mOrigGeneratorsIndices;
 
+	using CriticalPairsPtr = decltype(std::declval<Procedure<Polynomial, AddingPolynomialPolicy>&>().releaseCriticalPairs());
+	using CriticalPairs = typename CriticalPairsPtr::element_type;
+	/// A state saved by push().
+	struct Checkpoint
+	{
+		std::shared_ptr<Ideal<Polynomial>> mGb;
+		CriticalPairsPtr mCritPairs;
+		std::list<Polynomial> mInputScheduled;
+		size_t mNrOrigGenerators;
+		size_t mNrOrigGeneratorsIndices;
+	};
+	/// The saved states, the last one is restored by the next pop().
+	std::vector<Checkpoint> mCheckpoints;
+
+	/**
+	 * Copies the saved states of another procedure, such that neither ideals nor critical pairs are shared with it.
+	 * Ideals shared by several saved states or by a saved state and the current basis are shared within the copy as well.
+	 * Assumes that mGb is already a copy of the current basis of the other procedure.
+	 */
+	void copyCheckpoints(const GBProcedure& other)
+	{
+		std::map<const Ideal<Polynomial>*, std::shared_ptr<Ideal<Polynomial>>> copies;
+		copies.emplace(other.mGb.get(), mGb);
+		mCheckpoints.clear();
+		for(const Checkpoint& cp : other.mCheckpoints)
+		{
+			auto it = copies.find(cp.mGb.get());
+			if(it == copies.end())
+			{
+				it = copies.emplace(cp.mGb.get(), std::shared_ptr<Ideal<Polynomial>>(new Ideal<Polynomial>(*cp.mGb))).first;
+			}
+			mCheckpoints.push_back(Checkpoint{
+				it->second,
+				CriticalPairsPtr(new CriticalPairs(*cp.mCritPairs)),
+				cp.mInputScheduled,
+				cp.mNrOrigGenerators,
+				cp.mNrOrigGeneratorsIndices
+			});
+		}
+	}
+
 public:
 
 	GBProcedure():
@@ -61,7 +112,8 @@ public:
 		mGb(new Ideal<Polynomial>),
 		mInputScheduled(),
 		mOrigGenerators(),
-		mOrigGeneratorsIndices()
+		mOrigGeneratorsIndices(),
+		mCheckpoints()
 	{
 		Procedure<Polynomial, AddingPolynomialPolicy>::setIdeal(mGb);
 	}
@@ -72,9 +124,11 @@ public:
 		mGb(new Ideal<Polynomial>(*old.mGb)),
 		mInputScheduled(old.mInputScheduled),
 		mOrigGenerators(old.mOrigGenerators),
-		mOrigGeneratorsIndices(old.mOrigGeneratorsIndices)
+		mOrigGeneratorsIndices(old.mOrigGeneratorsIndices),
+		mCheckpoints()
 	{
 		Procedure<Polynomial, AddingPolynomialPolicy>::setIdeal(mGb);
+		copyCheckpoints(old);
 	}
 	
 	virtual ~GBProcedure() = default;
@@ -87,7 +141,8 @@ public:
 		mOrigGenerators = rhs.mOrigGenerators;
 		mOrigGeneratorsIndices = rhs.mOrigGeneratorsIndices;
 		Procedure<Polynomial, AddingPolynomialPolicy>::setIdeal(mGb);
-        Procedure<Polynomial, AddingPolynomialPolicy>::setCriticalPairs(rhs.pCritPairs);
+		Procedure<Polynomial, AddingPolynomialPolicy>::setCriticalPairs(CriticalPairsPtr(new CriticalPairs(*rhs.pCritPairs)));
+		copyCheckpoints(rhs);
 		return *this;
 	}
 	
@@ -170,6 +225,16 @@ public:
 	}
 	
 	
+	/**
+	 * Set the strategy which is used to select the next S-pair.
+	 * It takes effect in the next call to calculate() which starts without pending S-pairs.
+	 * @param strategy The strategy.
+	 */
+	void setPairSelectionStrategy(PairSelectionStrategy strategy)
+	{
+		Procedure<Polynomial, AddingPolynomialPolicy>::setPairSelectionStrategy(strategy);
+	}
+
 	/**
 	 * Remove all polynomials from the Groebner basis.
      */
@@ -179,6 +244,46 @@ public:
 		Procedure<Polynomial, AddingPolynomialPolicy>::setIdeal(mGb);
 	}
 	
+	/**
+	 * Save the current state, that is the basis, the critical pairs and the scheduled polynomials.
+	 * Nothing is copied but the list of scheduled polynomials.
+	 */
+	void push()
+	{
+		mCheckpoints.push_back(Checkpoint{
+			mGb,
+			Procedure<Polynomial, AddingPolynomialPolicy>::releaseCriticalPairs(),
+			mInputScheduled,
+			mOrigGenerators.size(),
+			mOrigGeneratorsIndices.size()
+		});
+	}
+
+	/**
+	 * Restore the state saved by the last call to push().
+	 */
+	void pop()
+	{
+		assert(!mCheckpoints.empty());
+		Checkpoint& cp = mCheckpoints.back();
+		mGb = cp.mGb;
+		Procedure<Polynomial, AddingPolynomialPolicy>::setIdeal(mGb);
+		Procedure<Polynomial, AddingPolynomialPolicy>::setCriticalPairs(cp.mCritPairs);
+		mInputScheduled.swap(cp.mInputScheduled);
+		mOrigGenerators.erase(mOrigGenerators.begin() + long(cp.mNrOrigGenerators), mOrigGenerators.end());
+		mOrigGeneratorsIndices.resize(cp.mNrOrigGeneratorsIndices);
+		mCheckpoints.pop_back();
+	}
+
+	/**
+	 * The number of states saved by push() which have not been restored yet.
+	 * @return number of saved states.
+	 */
+	size_t nrCheckpoints() const
+	{
+		return mCheckpoints.size();
+	}
+
 	/**
 	 * Get the ideal which encodes the GB.
      * @return 
@@ -198,15 +303,29 @@ public:
 		{
 			return;
 		}
+		// If the current basis belongs to a saved state, we extend it only temporarily.
+		std::shared_ptr<Ideal<Polynomial>> saved;
+		if(!mCheckpoints.empty() && mCheckpoints.back().mGb == mGb)
+		{
+			saved = mGb;
+			saved->checkpoint();
+		}
 		// Use procedure
 		Procedure<Polynomial, AddingPolynomialPolicy>::calculate(mInputScheduled);
 		// remove the just added polynomials from the set of input polynomials
 		mInputScheduled.clear();
-		mGb->removeEliminated();
+		if(!saved)
+		{
+			mGb->removeEliminated();
+		}
 		CARL_LOG_DEBUG("carl.gb.gbproc", "GB, before reduction: " << *mGb);
 		// We have to update our indices list. but we do this just before returning because in the next step
 		// we further shrink the size.
 		reduceGB();
+		if(saved)
+		{
+			saved->restore();
+		}
 	}
 
 	/**
@@ -262,12 +381,13 @@ private:
 	{
 		for(size_t i = 0; i < mGb->nrGenerators(); ++i)
 		{
+			if(mGb->isEliminated(i)) continue;
 			bool divisible = false;
 
 			CARL_LOG_TRACE("carl.gb.gbproc", "Check " << mGb->getGenerator(i));
 			for(size_t j = 0; !divisible && j != mGb->nrGenerators(); ++j)
 			{
-				if(j == i) continue;
+				if(j == i || mGb->isEliminated(j)) continue;
 
 				divisible = mGb->getGenerator(i).lmon()->divisible(mGb->getGenerator(j).lmon());
 				CARL_LOG_TRACE("carl.gb.gbproc", "" << (divisible ? "" : "not ") << "divisible by " << mGb->getGenerator(j));
@@ -279,11 +399,12 @@ private:
 				mGb->eliminateGenerator(i);
 			}
 		}
-		mGb->removeEliminated();
 		CARL_LOG_DEBUG("carl.gb.gbproc", "GB Reduction, minimal GB: " << *mGb);
 		// Calculate reduction
 		// The number of polynomials will not change anymore!
 		std::vector<size_t> toBeReduced(mGb->getOrderedIndices());
+		// Eliminated generators are kept in a saved basis, skip them.
+		toBeReduced.erase(std::remove_if(toBeReduced.begin(), toBeReduced.end(), [this](size_t index){ return mGb->isEliminated(index); }), toBeReduced.end());
 
 		std::shared_ptr<Ideal<Polynomial>> reduced(new Ideal<Polynomial>());
 		for(std::vector<size_t>::const_iterator index = toBeReduced.begin(); index != toBeReduced.end(); ++index)
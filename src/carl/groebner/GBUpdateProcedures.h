@@ -7,6 +7,9 @@
 #pragma once
 
 #include "../core/polynomialfunctions/SeparablePart.h"
+#ifdef BUCHBERGER_STATISTICS
+#include "gb-buchberger/BuchbergerStats.h"
+#endif
 
 namespace carl
 {
@@ -74,7 +77,7 @@ public:
 			assert(!p.isConstant());
 			Polynomial q(carl::separable_part(*p.lmon()));
 #ifdef BUCHBERGER_STATISTICS
-			if(q.lterm().tdeg() != p.lterm().tdeg()) mStats->SingleTermSFP();
+			if(q.lterm().tdeg() != p.lterm().tdeg()) BuchbergerStats::getInstance()->SingleTermSFP();
 #endif
 			q.setReasons(p.getReasons());
 			size_t index = gb->addGenerator(q);
@@ -85,7 +88,7 @@ public:
 			if(p.hasConstantTerm())
 			{
 #ifdef BUCHBERGER_STATISTICS
-				if(p.nrOfTerms() > 1) mStats->TSQWithConstant();
+				if(p.nrTerms() > 1) BuchbergerStats::getInstance()->TSQWithConstant();
 #endif
 				gb->clear();
 				Polynomial q(1);
@@ -96,14 +99,14 @@ public:
 			else
 			{
 #ifdef BUCHBERGER_STATISTICS
-				mStats->TSQWithoutConstant();
+				BuchbergerStats::getInstance()->TSQWithoutConstant();
 #endif
 				Polynomial remainder(p);
 				while(!carl::isZero(remainder))
 				{
 					Polynomial r1(carl::separable_part(*remainder.lmon()));
 #ifdef BUCHBERGER_STATISTICS
-					if(remainder.lterm().tdeg() != r1.lterm().tdeg()) mStats->SingleTermSFP();
+					if(remainder.lterm().tdeg() != r1.lterm().tdeg()) BuchbergerStats::getInstance()->SingleTermSFP();
 #endif
 					r1.setReasons(p.getReasons());
 					remainder.stripLT();
@@ -115,7 +118,7 @@ public:
 		else if(p.isReducibleIdentity())
 		{
 #ifdef BUCHBERGER_STATISTICS
-			mStats->ReducibleIdentity();
+			BuchbergerStats::getInstance()->ReducibleIdentity();
 #endif
 			Polynomial r;
 			CARL_LOG_NOTIMPLEMENTED();
@@ -29,6 +29,8 @@ private:
 
     std::unordered_set<size_t> mEliminated;
     Datastructure<Polynomial> mDivisorLookup = Datastructure<Polynomial>(mGenerators, mEliminated, mTermOrder);
+    /// Number of generators protected by checkpoint(), zero if there is no checkpoint.
+    size_t mCheckpoint = 0;
 public:
 
     Ideal() = default;
@@ -56,6 +58,7 @@ public:
     Ideal& operator=(const Ideal& rhs)
     {
         if(this == &rhs) return *this;
+        this->mCheckpoint = 0;
         this->mGenerators.assign(rhs.mGenerators.begin(), rhs.mGenerators.end());
         this->mEliminated = rhs.mEliminated;
 		this->mDivisorLookup = Datastructure<Polynomial>(mGenerators, mEliminated, mTermOrder);
@@ -123,12 +126,46 @@ public:
         mEliminated.insert(index);
     }
 
+    bool isEliminated(size_t index) const
+    {
+        return mEliminated.count(index) > 0;
+    }
+
+    /**
+     * Protects the current generators until restore() is called.
+     * In the meantime, generators may be added and eliminated, but the protected ones are never physically removed.
+     */
+    void checkpoint()
+    {
+        removeEliminated();
+        mDivisorLookup.reset();
+        mCheckpoint = mGenerators.size();
+    }
+
+    /**
+     * Drops all generators added since checkpoint() and revives the protected ones.
+     * Does not copy any polynomial.
+     */
+    void restore()
+    {
+        mGenerators.erase(mGenerators.begin() + long(mCheckpoint), mGenerators.end());
+        mEliminated.clear();
+        mDivisorLookup.reset();
+        mCheckpoint = 0;
+    }
+
+    bool hasCheckpoint() const
+    {
+        return mCheckpoint > 0;
+    }
+
     /**
      * Invalidates indices
      * @return a vector with the new indices
      */
     void removeEliminated()
     {
+        assert(!hasCheckpoint());
         std::vector<Polynomial> tempGen;
         for(size_t it = 0; it != mGenerators.size(); ++it)
         {
@@ -144,6 +181,15 @@ public:
 	
 	void clear()
 	{
+		if(hasCheckpoint())
+		{
+			// Protected generators are only hidden, restore() brings them back.
+			for(size_t i = 0; i < mGenerators.size(); ++i)
+			{
+				mEliminated.insert(i);
+			}
+			return;
+		}
 		mGenerators.clear();
 		mEliminated.clear();
 		mDivisorLookup.reset();
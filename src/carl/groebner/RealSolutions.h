@@ -0,0 +1,109 @@
+/**
+ * @file RealSolutions.h
+ * @ingroup gb
+ *
+ * Real solutions of zero-dimensional polynomial systems, obtained from a lexicographic Groebner basis
+ * by real root isolation and back substitution.
+ */
+
+#pragma once
+
+#include "FGLM.h"
+#include "../core/MultivariatePolynomial.h"
+#include "../core/Variables.h"
+#include "../core/logging.h"
+#include "../core/polynomialfunctions/to_univariate_polynomial.h"
+#include "../ran/ran.h"
+#include "../ran/real_roots.h"
+
+#include <algorithm>
+#include <map>
+#include <optional>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Computes all real solutions of a zero-dimensional system given by a Groebner basis with respect to LexOrdering.
+ *
+ * The generators are grouped by their greatest variable, which yields a triangular system.
+ * The variables are assigned from the least to the most significant one:
+ * for every partial solution, the real roots of all generators of the current variable are isolated
+ * and the common roots extend the partial solution.
+ * As the ideal is zero-dimensional, every variable occurs as a pure power in some leading monomial,
+ * hence one of these generators is never nullified.
+ * @param lexBasis Groebner basis with respect to LexOrdering, for example as computed by fglm().
+ * @return All real solutions, each assigning every variable of the basis.
+ * @ingroup gb
+ */
+template<typename Number, typename LexPolynomial>
+std::vector<ran_assignment<Number>> real_solutions(const std::vector<LexPolynomial>& lexBasis)
+{
+	using Poly = MultivariatePolynomial<Number>;
+	carlVariables vars;
+	std::map<Variable, std::vector<Poly>> triangular;
+	for(const auto& g: lexBasis)
+	{
+		if(isZero(g)) continue;
+		if(g.isConstant()) return {};
+		carlVariables gvars;
+		carl::variables(g, gvars);
+		carl::variables(g, vars);
+		Variable greatest = gvars.as_vector().back();
+		triangular[greatest].emplace_back(typename Poly::TermsType(g.begin(), g.end()));
+	}
+
+	std::vector<ran_assignment<Number>> partial = { ran_assignment<Number>() };
+	for(Variable v: vars.as_vector())
+	{
+		std::vector<ran_assignment<Number>> extended;
+		for(const auto& assignment: partial)
+		{
+			std::optional<std::vector<real_algebraic_number<Number>>> roots;
+			for(const auto& p: triangular[v])
+			{
+				auto res = carl::real_roots(carl::to_univariate_polynomial(p, v), assignment);
+				if(res.is_nullified()) continue;
+				assert(res.is_univariate());
+				if(!roots)
+				{
+					roots = res.roots();
+				}
+				else
+				{
+					const auto& other = res.roots();
+					roots->erase(std::remove_if(roots->begin(), roots->end(), [&other](const auto& r) {
+						return std::find(other.begin(), other.end(), r) == other.end();
+					}), roots->end());
+				}
+				if(roots->empty()) break;
+			}
+			assert(roots);
+			for(const auto& r: *roots)
+			{
+				extended.push_back(assignment);
+				extended.back().emplace(v, r);
+			}
+		}
+		CARL_LOG_DEBUG("carl.gb.fglm", extended.size() << " partial solutions after assigning " << v);
+		partial = std::move(extended);
+	}
+	return partial;
+}
+
+/**
+ * Computes all real solutions of a zero-dimensional system given by a reduced Groebner basis with respect to any ordering.
+ * The basis is converted to LexOrdering using FGLM first.
+ * @param gb Reduced Groebner basis with monic generators of a zero-dimensional ideal.
+ * @return All real solutions.
+ * @ingroup gb
+ */
+template<typename Number, typename Polynomial>
+std::vector<ran_assignment<Number>> real_solutions(const Ideal<Polynomial>& gb)
+{
+	using LexPolynomial = MultivariatePolynomial<typename Polynomial::CoeffType, LexOrdering>;
+	return real_solutions<Number>(fglm<LexPolynomial>(gb));
+}
+
+}
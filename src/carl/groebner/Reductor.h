@@ -9,7 +9,9 @@
 
 #include "Ideal.h"
 #include "ReductorEntry.h"
+#include "../util/Geobucket.h"
 #include "../util/Heap.h"
+#include "../util/TourTree.h"
 #include "../util/BitVector.h"
 
 namespace carl
@@ -60,6 +62,19 @@ public:
 	static const bool fastIndex = true;
 };
 
+/**
+ * @ingroup gb
+ * Settings for the reduction algorithm which let the data structure chain entries with equal leading monomials.
+ * The reductor then sums up their leading terms without reordering the data structure in between.
+ * Only supported by Geobucket and TourTree, not by Heap.
+ */
+template<class Polynomial>
+class DeduplicatingReductorConfiguration : public ReductorConfiguration<Polynomial>
+{
+public:
+	static const bool supportDeduplicationWhileOrdering = true;
+};
+
 /**
  * A dedicated algorithm for calculating the remainder of a polynomial modulo a set of other polynomials. 
  * @ingroup gb
@@ -8,7 +8,9 @@
 #pragma once
 
 #include <cassert>
+#include <string>
 #include "../../core/MultivariatePolynomial.h"
+#include "../../core/VariablePool.h"
 #include "../../util/stringparser.h"
 
 namespace carl
@@ -46,6 +48,46 @@ std::vector<MultivariatePolynomial<C, O, P>> cyclic3()
 
 
 
+/**
+ * Constructs the cyclic n-roots problem for an arbitrary number of variables x0, ..., x{n-1}.
+ * The k-th polynomial is the sum of all products of k cyclically consecutive variables,
+ * the last one is x0*...*x{n-1} - 1.
+ * @param n Number of variables.
+ * @return The generators of the cyclic n ideal.
+ */
+template<typename C, typename O, typename P>
+std::vector<MultivariatePolynomial<C, O, P>> cyclicN(unsigned n)
+{
+	using Poly = MultivariatePolynomial<C, O, P>;
+	std::vector<Variable> vars;
+	for(unsigned i = 0; i < n; ++i)
+	{
+		vars.push_back(freshRealVariable("x" + std::to_string(i)));
+	}
+	std::vector<Poly> res;
+	for(unsigned k = 1; k < n; ++k)
+	{
+		Poly sum;
+		for(unsigned i = 0; i < n; ++i)
+		{
+			Poly prod(constant_one<C>::get());
+			for(unsigned j = 0; j < k; ++j)
+			{
+				prod *= Poly(vars[(i + j) % n]);
+			}
+			sum += prod;
+		}
+		res.push_back(sum);
+	}
+	Poly prod(constant_one<C>::get());
+	for(Variable v: vars)
+	{
+		prod *= Poly(v);
+	}
+	res.push_back(prod - constant_one<C>::get());
+	return res;
+}
+
 #define run_cyclic_case(INDEX)	case INDEX: return cyclic##INDEX<C, O, P>()
 	
 template<typename C, typename O, typename P>
@@ -55,15 +97,10 @@ std::vector<MultivariatePolynomial<C, O, P>> cyclic(unsigned index)
 	{
 		run_cyclic_case(2);
 		run_cyclic_case(3);
-		//run_katsura_case(4);
-		//run_katsura_case(5);
-		//run_katsura_case(6);
-		//run_katsura_case(4);
 		default:
 			assert(index > 1);
-			assert(index < 4);
+			return cyclicN<C, O, P>(index);
 	}
-	return std::vector<MultivariatePolynomial<C, O, P>>();
 }
 	
 
@@ -7,7 +7,9 @@
 #pragma once
 
 #include <cassert>
+#include <string>
 #include "../../core/MultivariatePolynomial.h"
+#include "../../core/VariablePool.h"
 #include "../../util/stringparser.h"
 
 namespace carl 
@@ -87,6 +89,47 @@ std::vector<MultivariatePolynomial<C, O, P>> katsura5()
 
 
 
+/**
+ * Constructs the katsura problem for an arbitrary number of variables u0, ..., u{n-1}.
+ * With u{-i} = u{i} and u{i} = 0 for i >= n, the first polynomial is sum_i u{i} - 1
+ * and the m-th polynomial is sum_i u{i}*u{m-i} - u{m} for 0 <= m < n-1.
+ * @param n Number of variables.
+ * @return The generators of the katsura ideal, in the same form as katsura2() to katsura5().
+ */
+template<typename C, typename O, typename P>
+std::vector<MultivariatePolynomial<C, O, P>> katsuraN(unsigned n)
+{
+	using Poly = MultivariatePolynomial<C, O, P>;
+	std::vector<Variable> vars;
+	for(unsigned i = 0; i < n; ++i)
+	{
+		vars.push_back(freshRealVariable("u" + std::to_string(i)));
+	}
+	auto var = [&vars](long i) {
+		return Poly(vars[std::size_t(i < 0 ? -i : i)]);
+	};
+	long size = long(n);
+	std::vector<Poly> res;
+	Poly sum(-constant_one<C>::get());
+	for(long i = 1 - size; i < size; ++i)
+	{
+		sum += var(i);
+	}
+	res.push_back(sum);
+	for(long m = 0; m + 1 < size; ++m)
+	{
+		Poly p = -var(m);
+		for(long i = 1 - size; i < size; ++i)
+		{
+			long j = m - i;
+			if(j <= -size || j >= size) continue;
+			p += var(i) * var(j);
+		}
+		res.push_back(p);
+	}
+	return res;
+}
+
 #define run_katsura_case(INDEX)	case INDEX: return katsura##INDEX<C, O, P>()
 	
 template<typename C, typename O, typename P>
@@ -98,13 +141,10 @@ std::vector<MultivariatePolynomial<C, O, P>> katsura(unsigned index)
 		run_katsura_case(3);
 		run_katsura_case(4);
 		run_katsura_case(5);
-		//run_katsura_case(6);
-		//run_katsura_case(4);
 		default:
 			assert(index > 1);
-			assert(index < 6);
+			return katsuraN<C, O, P>(index);
 	}
-	return std::vector<MultivariatePolynomial<C, O, P>>();
 }
 	
 	
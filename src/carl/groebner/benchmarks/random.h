@@ -0,0 +1,91 @@
+/**
+ * @file   random.h
+ * Random ideals as benchmarks for Groebner basis computations.
+ */
+
+#pragma once
+
+#include <random>
+#include <string>
+#include "../../core/MultivariatePolynomial.h"
+#include "../../core/VariablePool.h"
+
+namespace carl
+{
+namespace benchmarks
+{
+
+/**
+ * Constructs an ideal with random integer coefficients.
+ * The polynomials consist of monomials of total degree at most the given degree.
+ * If terms is zero, every such monomial occurs (dense), otherwise the given number of monomials is drawn (sparse).
+ * Every polynomial gets a nonzero constant term such that the ideal is in general not homogeneous.
+ * @param variables Number of variables.
+ * @param polynomials Number of generators.
+ * @param degree Maximal total degree.
+ * @param terms Number of terms per polynomial, zero for dense polynomials.
+ * @param seed Seed for the random number generator, the same seed yields the same ideal.
+ * @return The generators of the ideal.
+ */
+template<typename C, typename O, typename P>
+std::vector<MultivariatePolynomial<C, O, P>> random_ideal(unsigned variables, unsigned polynomials, unsigned degree, unsigned terms, unsigned seed)
+{
+	using Poly = MultivariatePolynomial<C, O, P>;
+	std::vector<Variable> vars;
+	for(unsigned i = 0; i < variables; ++i)
+	{
+		vars.push_back(freshRealVariable("r" + std::to_string(i)));
+	}
+	// Enumerate all monomials up to the given degree.
+	std::vector<Poly> monomials = { Poly(constant_one<C>::get()) };
+	std::size_t lastDegree = 0;
+	for(unsigned d = 0; d < degree; ++d)
+	{
+		std::size_t end = monomials.size();
+		for(std::size_t m = lastDegree; m < end; ++m)
+		{
+			// Only extend by variables not smaller than the greatest one in the monomial to avoid duplicates.
+			for(std::size_t v = 0; v < vars.size(); ++v)
+			{
+				if(monomials[m].isConstant() || monomials[m].lmon()->exponents().back().first <= vars[v])
+				{
+					monomials.push_back(monomials[m] * Poly(vars[v]));
+				}
+			}
+		}
+		lastDegree = end;
+	}
+
+	std::mt19937 rand(seed);
+	std::uniform_int_distribution<int> coefficient(-10, 10);
+	auto nonzero = [&]() {
+		int c = 0;
+		while(c == 0) c = coefficient(rand);
+		return C(c);
+	};
+	std::vector<Poly> res;
+	for(unsigned i = 0; i < polynomials; ++i)
+	{
+		Poly p(nonzero());
+		if(terms == 0)
+		{
+			for(std::size_t m = 1; m < monomials.size(); ++m)
+			{
+				p += monomials[m] * nonzero();
+			}
+		}
+		else
+		{
+			std::uniform_int_distribution<std::size_t> index(1, monomials.size() - 1);
+			for(unsigned t = 0; t < terms; ++t)
+			{
+				p += monomials[index(rand)] * nonzero();
+			}
+		}
+		res.push_back(p);
+	}
+	return res;
+}
+
+}
+}
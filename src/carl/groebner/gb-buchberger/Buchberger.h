@@ -35,9 +35,14 @@
 #include "../Ideal.h"
 #include "../Reductor.h"
 #include "CriticalPairs.h"
+#ifdef BUCHBERGER_STATISTICS
+#include "BuchbergerStats.h"
+#endif
 
+#include <algorithm>
 #include <list>
 #include <unordered_map>
+#include <vector>
 
 namespace carl
 {
@@ -87,6 +92,16 @@ protected:
 	std::vector<size_t> mGbElementsIndices;
     std::shared_ptr<CritPairs> pCritPairs;
 	UpdateFnct<Buchberger<Polynomial, AddingPolicy>> mUpdateCallBack;
+	/// The strategy to select the next S-pair as requested by the user.
+	PairSelectionStrategy mPairSelection;
+	/**
+	 * The sugar degree of every generator added during the current call to calculate(), indexed as the generators of the ideal.
+	 * The generators are reindexed between calls, hence the sugar is reset at the beginning of every call and whenever the ideal is replaced.
+	 * Generators without a recorded sugar degree are treated like input polynomials, see sugar().
+	 */
+	std::vector<std::size_t> mSugar;
+	/// The sugar degree of the polynomial which is currently being added.
+	std::size_t mCurrentSugar;
 #ifdef BUCHBERGER_STATISTICS
 	BuchbergerStats* mStats;
 #endif
@@ -97,7 +112,13 @@ public:
 		pGb(),
 		mGbElementsIndices(),
 	    pCritPairs(new CritPairs()),
-		mUpdateCallBack(this)
+		mUpdateCallBack(this),
+		mPairSelection(PairSelectionStrategy::NORMAL),
+		mSugar(),
+		mCurrentSugar(0)
+#ifdef BUCHBERGER_STATISTICS
+		, mStats(BuchbergerStats::getInstance())
+#endif
 	{
 		
 	}
@@ -108,7 +129,13 @@ public:
 		pGb(new Ideal<Polynomial>(*rhs.pGb)),
 		mGbElementsIndices(rhs.mGbElementsIndices),
 		pCritPairs(new CritPairs(*rhs.pCritPairs)),
-		mUpdateCallBack(this)
+		mUpdateCallBack(this),
+		mPairSelection(rhs.mPairSelection),
+		mSugar(rhs.mSugar),
+		mCurrentSugar(0)
+#ifdef BUCHBERGER_STATISTICS
+		, mStats(rhs.mStats)
+#endif
 	{
 	}
 	
@@ -116,17 +143,54 @@ public:
 	void setIdeal(const std::shared_ptr<Ideal<Polynomial>>& ideal)
 	{
 		pGb = ideal;
+		mSugar.clear();
+		mCurrentSugar = 0;
 	}
 	void setCriticalPairs(const std::shared_ptr<CritPairs>& criticalPairs)
 	{
 		pCritPairs = criticalPairs;
 	}
+	/**
+	 * Hands out the current queue of critical pairs and continues with an empty one.
+	 * @return The previous queue, which can be reinstalled by setCriticalPairs().
+	 */
+	std::shared_ptr<CritPairs> releaseCriticalPairs()
+	{
+		std::shared_ptr<CritPairs> res(new CritPairs(pCritPairs->getStrategy()));
+		res.swap(pCritPairs);
+		return res;
+	}
+	/**
+	 * Sets the strategy to select the next S-pair.
+	 * It takes effect as soon as there are no pending critical pairs, usually in the next call to calculate().
+	 */
+	void setPairSelectionStrategy(PairSelectionStrategy strategy)
+	{
+		mPairSelection = strategy;
+	}
+	PairSelectionStrategy getPairSelectionStrategy() const
+	{
+		return mPairSelection;
+	}
 
 	//std::list<std::pair<BitVector, BitVector> > reduceInput();
 
 	void update(size_t index);
 protected:
 	
+	/**
+	 * Resolves the requested pair selection strategy for the current generators and the given input.
+	 */
+	PairSelectionStrategy selectStrategy(const std::list<Polynomial>& scheduledForAdding) const;
+	/**
+	 * @return The sugar degree of the generator with the given index, its total degree if it was not added during the current call to calculate().
+	 */
+	std::size_t sugar(std::size_t index) const
+	{
+		if(index < mSugar.size()) return mSugar[index];
+		return pGb->getGenerators()[index].totalDegree();
+	}
+
 	bool addToGb(const Polynomial& newPol)
 	{
 		 CARL_LOG_DEBUG("carl.gb.buchberger", "Add to gb: " << newPol);
@@ -40,14 +40,26 @@ template<class Polynomial, template<typename> class AddingPolicy>
 void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>& scheduledForAdding)
 {
 	CARL_LOG_INFO("carl.gb.buchberger", "Calculate gb");
+	// The existing generators may have been reindexed since the last call.
+	mSugar.clear();
+	mCurrentSugar = 0;
 	for(unsigned i = 0; i < pGb->getGenerators().size(); ++i)
 	{
 		mGbElementsIndices.push_back(i);
 	}
 
+	if(pCritPairs->empty())
+	{
+		pCritPairs->setStrategy(selectStrategy(scheduledForAdding));
+	}
+#ifdef BUCHBERGER_STATISTICS
+	mStats->PairSelection(pCritPairs->getStrategy());
+#endif
+
 	bool foundGB = false;
 	for(const Polynomial& newPol : scheduledForAdding)
 	{
+		mCurrentSugar = newPol.totalDegree();
 		if(addToGb(newPol))
 		{
 			CARL_LOG_INFO("carl.gb.buchberger", "Added a constant polynomial.");
@@ -64,6 +76,10 @@ void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>
 		{
 			// Takes the next pair scheduled
 			SPolPair critPair = pCritPairs->pop();
+#ifdef BUCHBERGER_STATISTICS
+			mStats->TreatSPair();
+			mStats->Sugar(critPair.mSugar);
+#endif
             assert( critPair.mP1 < pGb->getGenerators().size() );
             assert( critPair.mP2 < pGb->getGenerators().size() );
 			CARL_LOG_DEBUG("carl.gb.buchberger", "Calculate SPol for: " << pGb->getGenerators()[critPair.mP1] << ", " << pGb->getGenerators()[critPair.mP2]);
@@ -81,6 +97,9 @@ void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>
 			// If it is not zero, we should add this one to our GB
 			if(!isZero(remainder))
 			{
+#ifdef BUCHBERGER_STATISTICS
+				mStats->NonZeroReduction();
+#endif
 				// If it is constant, we are done and can return {1} as GB.
 				if(remainder.isConstant())
 				{
@@ -93,6 +112,7 @@ void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>
 
 					// divide the polynomial through the leading coefficient.
 
+					mCurrentSugar = std::max(critPair.mSugar, std::size_t(remainder.totalDegree()));
 					if(addToGb(remainder.normalize())) break;
 				}
 			}
@@ -101,6 +121,19 @@ void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>
 	mGbElementsIndices.clear();
 }
 
+template<class Polynomial, template<typename> class AddingPolicy>
+PairSelectionStrategy Buchberger<Polynomial, AddingPolicy>::selectStrategy(const std::list<Polynomial>& scheduledForAdding) const
+{
+	if(mPairSelection != PairSelectionStrategy::HOMOGENIZATION_AWARE) return mPairSelection;
+	auto isHomogeneous = [](const Polynomial& p) {
+		std::size_t degree = p.totalDegree();
+		return std::all_of(p.begin(), p.end(), [degree](const auto& t){ return t.tdeg() == degree; });
+	};
+	bool homogeneous = std::all_of(scheduledForAdding.begin(), scheduledForAdding.end(), isHomogeneous)
+		&& std::all_of(pGb->getGenerators().begin(), pGb->getGenerators().end(), isHomogeneous);
+	return homogeneous ? PairSelectionStrategy::NORMAL : PairSelectionStrategy::SUGAR;
+}
+
 
 //
 /**
@@ -116,6 +149,11 @@ void Buchberger<Polynomial, AddingPolicy>::update(const size_t index)
 	assert(!generators[index].isConstant());
 	auto jEnd = mGbElementsIndices.end();
 
+	while(mSugar.size() <= index) mSugar.push_back(generators[mSugar.size()].totalDegree());
+	mSugar[index] = std::max(mCurrentSugar, std::size_t(generators[index].totalDegree()));
+	// The sugar of a pair is the degree of the lcm plus the largest excess of the sugar over the leading degree.
+	std::size_t indexExcess = mSugar[index] - generators[index].lmon()->tdeg();
+
 	std::unordered_map<size_t, SPolPair> spairs;
 	std::vector<size_t> primelist;
 	for(auto jt = mGbElementsIndices.begin(); jt != jEnd; ++jt)
@@ -124,7 +162,10 @@ void Buchberger<Polynomial, AddingPolicy>::update(const size_t index)
 		size_t otherIndex = *jt;
 		assert(generators.size() > otherIndex);
 		uint oideg = generators[otherIndex].lmon() ? generators[otherIndex].lmon()->tdeg() : 0;
-		SPolPair sp(otherIndex, index, Monomial::lcm(generators[index].lmon(), generators[otherIndex].lmon()));
+		std::size_t otherSugar = sugar(otherIndex);
+		std::size_t otherExcess = otherSugar > oideg ? otherSugar - oideg : 0;
+		Monomial::Arg lcm = Monomial::lcm(generators[index].lmon(), generators[otherIndex].lmon());
+		SPolPair sp(otherIndex, index, lcm, lcm->tdeg() + std::max(indexExcess, otherExcess));
 		if(sp.mLcm->tdeg() == generators[index].lmon()->tdeg() + oideg)
 		{
 			// *generators[index].lmon( ), *generators[otherIndex].lmon( ) are prime.
@@ -152,7 +193,13 @@ void Buchberger<Polynomial, AddingPolicy>::update(const size_t index)
 	{
 		return val.second;
 	});
+#ifdef BUCHBERGER_STATISTICS
+	mStats->ScheduledSPairs(critPairsList.size());
+#endif
 	pCritPairs->push(critPairsList);
+#ifdef BUCHBERGER_STATISTICS
+	mStats->CriticalPairsMemory(pCritPairs->getMemoryUse());
+#endif
 
 	std::vector<size_t> tempIndices;
 	jEnd = mGbElementsIndices.end();
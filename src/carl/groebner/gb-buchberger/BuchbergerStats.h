@@ -28,6 +28,10 @@
 
 #pragma once
 
+#include "SPolPair.h"
+
+#include <cstddef>
+
 namespace carl
 {
 
@@ -83,6 +87,46 @@ public:
         mNrOfNonZeroReductions++;
     }
 
+    /**
+     * Count the S-Pairs that were scheduled after adding a new generator.
+     */
+    void ScheduledSPairs( std::size_t nr )
+    {
+        mNrOfScheduledSPairs += nr;
+    }
+
+    /**
+     * Record the current memory usage of the critical pairs, only the peak is kept.
+     */
+    void CriticalPairsMemory( std::size_t bytes )
+    {
+        if( bytes > mPeakCriticalPairsMemory ) mPeakCriticalPairsMemory = bytes;
+    }
+
+    /**
+     * Record the strategy which is used to select the S-Pairs.
+     */
+    void PairSelection( PairSelectionStrategy strategy )
+    {
+        mPairSelectionStrategy = strategy;
+    }
+
+    /**
+     * Record the sugar of a treated S-Pair, only the maximum is kept.
+     */
+    void Sugar( std::size_t sugar )
+    {
+        if( sugar > mMaxSugar ) mMaxSugar = sugar;
+    }
+
+    /**
+     * Reset all counters, for example between two benchmark runs.
+     */
+    void reset( )
+    {
+        *this = BuchbergerStats( );
+    }
+
     unsigned getNrTSQWithConstant( ) const
     {
         return mNrOfTSQWithConstant;
@@ -102,6 +146,41 @@ public:
     {
         return mNrOfReducibleIdentities;
     }
+
+    unsigned getNrReductions( ) const
+    {
+        return mNrOfReductions;
+    }
+
+    unsigned getNrNonZeroReductions( ) const
+    {
+        return mNrOfNonZeroReductions;
+    }
+
+    unsigned getNrZeroReductions( ) const
+    {
+        return mNrOfReductions - mNrOfNonZeroReductions;
+    }
+
+    std::size_t getNrScheduledSPairs( ) const
+    {
+        return mNrOfScheduledSPairs;
+    }
+
+    std::size_t getPeakCriticalPairsMemory( ) const
+    {
+        return mPeakCriticalPairsMemory;
+    }
+
+    PairSelectionStrategy getPairSelectionStrategy( ) const
+    {
+        return mPairSelectionStrategy;
+    }
+
+    std::size_t getMaxSugar( ) const
+    {
+        return mMaxSugar;
+    }
 protected:
 
     BuchbergerStats( ) :
@@ -110,7 +189,11 @@ protected:
     mNrOfSingleTermSFP( 0 ),
     mNrOfReducibleIdentities( 0 ),
     mNrOfReductions( 0 ),
-    mNrOfNonZeroReductions( 0 )
+    mNrOfNonZeroReductions( 0 ),
+    mNrOfScheduledSPairs( 0 ),
+    mPeakCriticalPairsMemory( 0 ),
+    mPairSelectionStrategy( PairSelectionStrategy::NORMAL ),
+    mMaxSugar( 0 )
     {
     }
     unsigned mNrOfTSQWithConstant;
@@ -119,6 +202,10 @@ protected:
     unsigned mNrOfReducibleIdentities;
     unsigned mNrOfReductions;
     unsigned mNrOfNonZeroReductions;
+    std::size_t mNrOfScheduledSPairs;
+    std::size_t mPeakCriticalPairsMemory;
+    PairSelectionStrategy mPairSelectionStrategy;
+    std::size_t mMaxSugar;
 
 private:
     static BuchbergerStats* instance;
@@ -44,9 +44,12 @@ public:
     using Entry = CriticalPairsEntry<Compare>*;
     using CompareResult = carl::CompareResult;
 
-    static CompareResult compare( Entry e1, Entry e2 )
+    explicit CriticalPairConfiguration( PairSelectionStrategy strategy = PairSelectionStrategy::NORMAL ) : mStrategy( strategy )
+    {}
+
+    CompareResult compare( Entry e1, Entry e2 ) const
     {
-        return Compare::compare( e1->getSortedFirstLCM( ), e2->getSortedFirstLCM( ) );
+        return compareSPolPairs<Compare>( mStrategy, e1->getFirst( ), e2->getFirst( ) );
     }
 
     static bool cmpLessThan( CompareResult res )
@@ -62,6 +65,9 @@ public:
 
     using Order = Compare;
     static const bool fastIndex = true;
+
+    /// The strategy used to compare pairs, HOMOGENIZATION_AWARE must have been resolved.
+    PairSelectionStrategy mStrategy;
 };
 
 
@@ -73,7 +79,7 @@ class CriticalPairs
 {
 public:
 
-    CriticalPairs( ) : mDatastruct( Configuration( ) )
+    explicit CriticalPairs( PairSelectionStrategy strategy = PairSelectionStrategy::NORMAL ) : mDatastruct( Configuration( strategy ) )
     {
 
     }
@@ -85,7 +91,27 @@ public:
     void push( std::list<SPolPair> pairs )
     {
         if( pairs.empty( ) ) return;
-        mDatastruct.push( new CriticalPairsEntry<typename Configuration::Order > ( std::move(pairs) ) );
+        mDatastruct.push( new CriticalPairsEntry<typename Configuration::Order > ( std::move(pairs), getStrategy( ) ) );
+    }
+
+	/**
+	 * The strategy used to select the next pair.
+     * @return 
+     */
+    PairSelectionStrategy getStrategy( ) const
+    {
+        return mDatastruct.getConfiguration( ).mStrategy;
+    }
+
+	/**
+	 * Changes the strategy used to select the next pair, which is only possible as long as no pairs are stored.
+     * @param strategy
+     */
+    void setStrategy( PairSelectionStrategy strategy )
+    {
+        assert( empty( ) );
+        assert( strategy != PairSelectionStrategy::HOMOGENIZATION_AWARE );
+        mDatastruct.getConfiguration( ).mStrategy = strategy;
     }
 
 	/**
@@ -127,6 +153,21 @@ public:
         return mDatastruct.size( );
     }
 
+	/**
+	 * Memory used by the underlying data structure and all stored entries in bytes.
+	 * The monomials referenced by the pairs are shared with the polynomials and hence not included.
+     * @return 
+     */
+    size_t getMemoryUse( ) const
+    {
+        size_t res = mDatastruct.getMemoryUse( );
+        for( auto it = mDatastruct.begin( ); it != mDatastruct.end( ); it.next( ) )
+        {
+            res += it.get( )->getMemoryUse( );
+        }
+        return res;
+    }
+
 private:
     Datastructure<Configuration> mDatastruct;
 };
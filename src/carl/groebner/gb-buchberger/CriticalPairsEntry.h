@@ -48,10 +48,11 @@ public:
 	/**
 	 * Saves the list of pairs and sorts them according the configured ordering.
      * @param pairs
+     * @param strategy The strategy used to select the pairs.
      */
-    explicit CriticalPairsEntry(std::list<SPolPair>&& pairs) : mPairs(std::move(pairs))
+    explicit CriticalPairsEntry(std::list<SPolPair>&& pairs, PairSelectionStrategy strategy = PairSelectionStrategy::NORMAL) : mPairs(std::move(pairs))
     {
-        mPairs.sort(SPolPairCompare<Compare>());
+        mPairs.sort(SPolPairCompare<Compare>{strategy});
     }
 
 	/**
@@ -121,6 +122,15 @@ public:
         return mPairs.erase(it);
     }
 
+	/**
+	 * Memory used by this entry and its list of pairs in bytes, excluding the monomials referenced by the pairs.
+     * @return 
+     */
+    std::size_t getMemoryUse() const {
+        // every list node stores the pair and two links
+        return sizeof(*this) + mPairs.size() * (sizeof(SPolPair) + 2 * sizeof(void*));
+    }
+
     void print( std::ostream& os = std::cout )
     {
 		for (const auto& p: mPairs) {
@@ -3,40 +3,94 @@
  * @ingroup gb
  * @author Sebastian Junges
  */
-#pragma once 
+#pragma once
 
+#include "../../core/CompareResult.h"
 #include "../../core/Monomial.h"
 
-namespace carl 
+#include <ostream>
+
+namespace carl
 {
+    /**
+     * Strategies to select the next S-pair in the Buchberger algorithm.
+     * The sugar of a pair is the degree its S-polynomial would have if the input was homogenized.
+     * @ingroup gb
+     */
+    enum class PairSelectionStrategy {
+        /// Smallest lcm with respect to the monomial ordering.
+        NORMAL,
+        /// Smallest sugar, ties are broken by the normal strategy.
+        SUGAR,
+        /// Smallest sugar, then smallest ecart (sugar minus degree of the lcm), then the normal strategy.
+        DOUBLESUGAR,
+        /// Normal strategy if all input polynomials are homogeneous, as the sugar is the degree of the lcm then, sugar strategy otherwise.
+        HOMOGENIZATION_AWARE
+    };
+
+    inline std::ostream& operator<<(std::ostream& os, PairSelectionStrategy strategy) {
+        switch (strategy) {
+            case PairSelectionStrategy::NORMAL: return os << "normal";
+            case PairSelectionStrategy::SUGAR: return os << "sugar";
+            case PairSelectionStrategy::DOUBLESUGAR: return os << "double sugar";
+            case PairSelectionStrategy::HOMOGENIZATION_AWARE: return os << "homogenization aware";
+        }
+        return os;
+    }
+
     /**
      * Basic spol-pair. Optimizations could be deducing p2 from the structure where it is saved, and not saving the lcm.
-     * Also sugar might be added.
      * @param p1 index of polynomial p1
      * @param p2 index of polynomial p2
      * @param lcm the lcm(lt(p1), lt(p2))
+     * @param sugar the sugar degree of the S-polynomial
      */
     struct SPolPair
     {
-        SPolPair( std::size_t p1, std::size_t p2, Monomial::Arg lcm ) : mP1(p1), mP2(p2), mLcm(std::move(lcm))
+        SPolPair( std::size_t p1, std::size_t p2, Monomial::Arg lcm, std::size_t sugar = 0 ) : mP1(p1), mP2(p2), mLcm(std::move(lcm)), mSugar(sugar)
         {}
 
         const std::size_t mP1;
         const std::size_t mP2;
         const Monomial::Arg mLcm;
+        const std::size_t mSugar;
 
         void print(std::ostream& os = std::cout) const
         {
-            os << "(" << mP1 << "," << mP2 << "): " << mLcm;
+            os << "(" << mP1 << "," << mP2 << "): " << mLcm << " [" << mSugar << "]";
         }
     };
 
+    /**
+     * Compares two pairs according to a selection strategy, the pair to be selected first is the smaller one.
+     * HOMOGENIZATION_AWARE must be resolved to NORMAL or SUGAR before.
+     */
+    template <class Compare>
+    CompareResult compareSPolPairs( PairSelectionStrategy strategy, const SPolPair& s1, const SPolPair& s2 )
+    {
+        assert( strategy != PairSelectionStrategy::HOMOGENIZATION_AWARE );
+        if( strategy != PairSelectionStrategy::NORMAL && s1.mSugar != s2.mSugar )
+        {
+            return s1.mSugar < s2.mSugar ? CompareResult::LESS : CompareResult::GREATER;
+        }
+        if( strategy == PairSelectionStrategy::DOUBLESUGAR )
+        {
+            // The sugars are equal, hence a smaller ecart means a larger lcm degree.
+            std::size_t d1 = s1.mLcm->tdeg();
+            std::size_t d2 = s2.mLcm->tdeg();
+            if( d1 != d2 ) return d1 > d2 ? CompareResult::LESS : CompareResult::GREATER;
+        }
+        return Compare::compare( s1.mLcm, s2.mLcm );
+    }
+
     template <class Compare>
     struct SPolPairCompare
     {
+        PairSelectionStrategy mStrategy = PairSelectionStrategy::NORMAL;
+
         bool operator( )(const SPolPair& s1, const SPolPair & s2 )
         {
-            return Compare::less( s1.mLcm, s2.mLcm );
+            return compareSPolPairs<Compare>( mStrategy, s1, s2 ) == CompareResult::LESS;
         }
     };
 }
@@ -9,4 +9,5 @@
 
 #include "GBProcedure.h"
 #include "gb-buchberger/Buchberger.h"
-#include "Reductor.h"
\ No newline at end of file
+#include "Reductor.h"
+#include "FGLM.h"
\ No newline at end of file
@@ -0,0 +1,179 @@
+#pragma once
+
+#include "../core/MultivariatePolynomial.h"
+#include "../core/Sign.h"
+#include "Interval.h"
+#include "IntervalEvaluation.h"
+#include "power.h"
+
+#include <cmath>
+#include <limits>
+#include <map>
+#include <optional>
+
+namespace carl {
+
+/**
+ * Interval evaluation of polynomials over rational intervals with adaptive precision.
+ *
+ * The polynomial is evaluated with double intervals first. If the resulting interval contains zero, but one of its bounds lies on the wrong side of zero
+ * by no more than the rounding errors of the evaluation could explain, the evaluation is repeated with 128, 256, ... bits of precision
+ * and finally with exact rational arithmetic. Otherwise the sign is undetermined due to the overestimation of interval arithmetic itself,
+ * which more precision does not cure, and the result is returned immediately.
+ * Hence signs are certified at the cost of a double evaluation in most cases, and only close calls pay for higher precision.
+ *
+ * Arbitrary precision evaluation uses dyadic rational intervals: every bound of every intermediate result is rounded outward to the given number of significant bits.
+ */
+class AdaptiveEvaluation {
+public:
+	template<typename Rational>
+	struct Result {
+		/// Enclosure of the range of the polynomial.
+		Interval<Rational> interval;
+		/// The sign of the polynomial if it is the same on the whole box.
+		std::optional<Sign> sign;
+		/// The precision in bits of the last evaluation, zero if it was exact.
+		std::size_t precision;
+	};
+
+	/**
+	 * Evaluates the polynomial on the given intervals.
+	 * @param p Polynomial.
+	 * @param map Intervals of all variables of p.
+	 * @param max_precision Maximal precision in bits before falling back to exact arithmetic.
+	 */
+	template<typename Coeff, typename Policy, typename Ordering>
+	static Result<Coeff> evaluate(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const std::map<Variable, Interval<Coeff>>& map, std::size_t max_precision = 1024) {
+		std::map<Variable, Interval<double>> box;
+		for (const auto& [var, i]: map) {
+			box.emplace(var, Interval<double>(i.lower(), i.lowerBoundType(), i.upper(), i.upperBoundType()));
+		}
+		Interval<double> approximation = IntervalEvaluation::evaluate(p, box);
+		Result<Coeff> res{to_rational<Coeff>(approximation), sign(approximation), 53};
+		CARL_LOG_DEBUG("carl.interval", "Evaluating " << p << " with double precision: " << approximation);
+		if (res.sign || approximation.isUnbounded() || approximation.isEmpty()) return res;
+
+		double bound = magnitude_bound(p, box);
+		// Without a finite bound on the rounding errors, only exact arithmetic is known to help.
+		if (std::isfinite(bound)) {
+			Coeff magnitude = carl::rationalize<Coeff>(bound);
+			std::size_t operations = number_of_operations(p);
+			for (std::size_t precision = 128; ; precision *= 2) {
+				if (!rounding_affected(res.interval, error_bound(magnitude, operations, res.precision))) return res;
+				if (precision > max_precision) break;
+				res.interval = evaluate_dyadic(p, map, precision);
+				res.sign = sign(res.interval);
+				res.precision = precision;
+				CARL_LOG_DEBUG("carl.interval", "Evaluating " << p << " with " << precision << " bits: " << res.interval);
+				if (res.sign) return res;
+			}
+		}
+		res.interval = IntervalEvaluation::evaluate(p, map);
+		res.sign = sign(res.interval);
+		res.precision = 0;
+		CARL_LOG_DEBUG("carl.interval", "Evaluating " << p << " exactly: " << res.interval);
+		return res;
+	}
+
+private:
+	template<typename Number>
+	static std::optional<Sign> sign(const Interval<Number>& i) {
+		if (i.isZero()) return Sign::ZERO;
+		if (i.isPositive()) return Sign::POSITIVE;
+		if (i.isNegative()) return Sign::NEGATIVE;
+		return std::nullopt;
+	}
+
+	template<typename Rational>
+	static Interval<Rational> to_rational(const Interval<double>& i) {
+		Rational lower = i.lowerBoundType() == BoundType::INFTY ? carl::constant_zero<Rational>().get() : carl::rationalize<Rational>(i.lower());
+		Rational upper = i.upperBoundType() == BoundType::INFTY ? carl::constant_zero<Rational>().get() : carl::rationalize<Rational>(i.upper());
+		return Interval<Rational>(lower, i.lowerBoundType(), upper, i.upperBoundType());
+	}
+
+	/// Computes an upper bound on the sum of |c| * |x_1|^e_1 * ... * |x_n|^e_n over all terms, which scales the rounding errors.
+	/// Returns infinity if the bound overflows.
+	template<typename Coeff, typename Policy, typename Ordering>
+	static double magnitude_bound(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const std::map<Variable, Interval<double>>& box) {
+		Interval<double> res(0.0);
+		for (const auto& t: p) {
+			Interval<double> term(Interval<double>(t.coeff()).magnitude());
+			if (t.monomial()) {
+				for (const auto& [var, exp]: *t.monomial()) {
+					term *= carl::pow(Interval<double>(box.at(var).magnitude()), exp);
+				}
+			}
+			res += term;
+		}
+		if (res.upperBoundType() == BoundType::INFTY) return std::numeric_limits<double>::infinity();
+		return res.upper();
+	}
+
+	/// Counts the arithmetic operations of a term-wise evaluation, each of which causes at most one rounding error.
+	template<typename Coeff, typename Policy, typename Ordering>
+	static std::size_t number_of_operations(const MultivariatePolynomial<Coeff, Policy, Ordering>& p) {
+		std::size_t res = p.nrTerms();
+		for (const auto& t: p) {
+			res += t.tdeg() + 1;
+		}
+		return res;
+	}
+
+	/// Computes operations * 2^(1 - precision) * magnitude.
+	template<typename Rational>
+	static Rational error_bound(const Rational& magnitude, std::size_t operations, std::size_t precision) {
+		return carl::fromInt<Rational>(uint(operations)) * magnitude / carl::pow(Rational(2), precision - 1);
+	}
+
+	/// Checks whether a bound lies on the wrong side of zero by at most the given error.
+	template<typename Rational>
+	static bool rounding_affected(const Interval<Rational>& i, const Rational& error) {
+		if (i.lowerBoundType() != BoundType::INFTY && i.lower() < 0 && -i.lower() <= error) return true;
+		if (i.upperBoundType() != BoundType::INFTY && i.upper() > 0 && i.upper() <= error) return true;
+		return false;
+	}
+
+	/// Rounds r down or up to a dyadic rational with the given number of significant bits.
+	template<typename Rational>
+	static Rational round(const Rational& r, std::size_t precision, bool up) {
+		if (carl::isZero(r)) return r;
+		long exponent = long(carl::bitsize(carl::getNum(r))) - long(carl::bitsize(carl::getDenom(r)));
+		long shift = long(precision) - exponent;
+		Rational scale = carl::pow(Rational(2), std::size_t(shift < 0 ? -shift : shift));
+		if (shift < 0) scale = carl::constant_one<Rational>().get() / scale;
+		Rational scaled = r * scale;
+		return Rational(up ? carl::ceil(scaled) : carl::floor(scaled)) / scale;
+	}
+
+	/// Rounds the bounds of i outward to the given number of significant bits.
+	template<typename Rational>
+	static Interval<Rational> round(const Interval<Rational>& i, std::size_t precision) {
+		if (i.isEmpty()) return i;
+		Interval<Rational> res(i);
+		if (i.lowerBoundType() != BoundType::INFTY) res.setLower(round(i.lower(), precision, false));
+		if (i.upperBoundType() != BoundType::INFTY) res.setUpper(round(i.upper(), precision, true));
+		return res;
+	}
+
+	template<typename Coeff, typename Policy, typename Ordering>
+	static Interval<Coeff> evaluate_dyadic(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const std::map<Variable, Interval<Coeff>>& map, std::size_t precision) {
+		std::map<Variable, Interval<Coeff>> box;
+		for (const auto& [var, i]: map) {
+			box.emplace(var, round(i, precision));
+		}
+		Interval<Coeff> res(carl::constant_zero<Coeff>().get());
+		for (const auto& t: p) {
+			Interval<Coeff> term = round(Interval<Coeff>(t.coeff()), precision);
+			if (t.monomial()) {
+				for (const auto& [var, exp]: *t.monomial()) {
+					CARL_LOG_ASSERT("carl.interval", box.count(var) > 0, "Every variable is expected to be in the map.");
+					term = round(term * round(carl::pow(box.at(var), exp), precision), precision);
+				}
+			}
+			res = round(res + term, precision);
+		}
+		return res;
+	}
+};
+
+}
@@ -0,0 +1,235 @@
+#pragma once
+
+#include "../core/MultivariatePolynomial.h"
+#include "Interval.h"
+#include "IntervalBox.h"
+#include "sampling.h"
+
+#include <map>
+#include <vector>
+
+namespace carl {
+
+/**
+ * Affine form x_0 + x_1 e_1 + ... + x_n e_n + E, where every noise symbol e_i ranges over [-1,1] and E is an interval.
+ *
+ * The noise symbols are the variables of the box the form is evaluated on, hence two forms depending on the same variable are correlated:
+ * for example x - x evaluates to zero and x^2 - 2x on [0,2] evaluates to [-1,0], whereas plain interval arithmetic yields [-4,4].
+ * The nonlinear part of a product is not linear in the noise symbols and is enclosed in the error E.
+ * All coefficients are intervals, such that rounding errors of the coefficients are accounted for by the interval arithmetic.
+ */
+template<typename Number>
+class AffineForm {
+	using I = Interval<Number>;
+
+	/// The central value x_0.
+	I mCenter;
+	/// The partial deviations x_i with respect to the noise symbols.
+	std::map<Variable, I> mDeviations;
+	/// Enclosure of all terms that are not linear in the noise symbols.
+	I mError;
+
+	static I symmetric(const Number& radius) {
+		return I(-radius, radius);
+	}
+	static I unit_interval() {
+		return I(carl::constant_zero<Number>().get(), carl::constant_one<Number>().get());
+	}
+
+	/// Computes an upper bound on sum |x_i|.
+	Number radius() const {
+		I res(0);
+		for (const auto& d: mDeviations) {
+			res += I(d.second.magnitude());
+		}
+		return res.upper();
+	}
+
+	/**
+	 * Encloses (x_1 e_1 + ... + x_n e_n) * (y_1 e_1 + ... + y_n e_n).
+	 * The squares e_i^2 range over [0,1], the mixed products e_i e_j over [-1,1].
+	 */
+	static I quadratic_part(const AffineForm& lhs, const AffineForm& rhs) {
+		I res(0);
+		// Sum of |y_j| for all j != i, as prefix[i] + suffix[i+1] over the noise symbols of lhs.
+		std::vector<const I*> factors;
+		std::vector<I> suffix(lhs.mDeviations.size() + 1, I(0));
+		for (const auto& d: lhs.mDeviations) {
+			auto it = rhs.mDeviations.find(d.first);
+			factors.push_back(it == rhs.mDeviations.end() ? nullptr : &it->second);
+		}
+		std::size_t i = lhs.mDeviations.size();
+		for (auto it = lhs.mDeviations.rbegin(); it != lhs.mDeviations.rend(); ++it) {
+			--i;
+			suffix[i] = suffix[i + 1] + (factors[i] ? I(factors[i]->magnitude()) : I(0));
+		}
+		// Deviations of rhs whose noise symbols do not occur in lhs.
+		I others(0);
+		for (const auto& d: rhs.mDeviations) {
+			if (lhs.mDeviations.find(d.first) == lhs.mDeviations.end()) others += I(d.second.magnitude());
+		}
+		I prefix(0);
+		I mixed(0);
+		i = 0;
+		for (const auto& d: lhs.mDeviations) {
+			I magnitude(d.second.magnitude());
+			mixed += magnitude * (prefix + suffix[i + 1] + others);
+			if (factors[i]) {
+				res += d.second * *factors[i] * unit_interval();
+				prefix += I(factors[i]->magnitude());
+			}
+			++i;
+		}
+		return res + symmetric(mixed.upper());
+	}
+
+	template<typename Coeff, typename Policy, typename Ordering, typename Assignment>
+	static AffineForm evaluate_polynomial(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const Assignment& map) {
+		std::map<Variable, std::vector<AffineForm>> powers;
+		AffineForm res(carl::constant_zero<Number>().get());
+		for (const auto& t: p) {
+			AffineForm term(I(t.coeff()));
+			if (t.monomial()) {
+				for (const auto& [var, exp]: *t.monomial()) {
+					auto& cache = powers[var];
+					if (cache.empty()) {
+						CARL_LOG_ASSERT("carl.interval", map.count(var) > 0, "Every variable is expected to be in the map.");
+						cache.emplace_back(carl::constant_one<Number>().get());
+						cache.emplace_back(variable(var, map.at(var)));
+					}
+					while (cache.size() <= exp) {
+						cache.emplace_back(cache.back() * cache[1]);
+					}
+					term = term * cache[exp];
+				}
+			}
+			res += term;
+		}
+		return res;
+	}
+
+public:
+	/// Constructs the constant form c.
+	explicit AffineForm(const Number& c = carl::constant_zero<Number>().get()):
+		mCenter(c), mError(0)
+	{}
+	/// Constructs the constant form that is only known to lie within the given interval.
+	explicit AffineForm(const I& i):
+		mCenter(i), mError(0)
+	{}
+
+	/**
+	 * Constructs the form of a variable ranging over the given interval, i.e. m + r e_v for the center m and the radius r of the interval.
+	 * If the interval is unbounded, the form is the constant form of the interval.
+	 */
+	static AffineForm variable(Variable v, const I& domain) {
+		if (domain.isUnbounded() || domain.isEmpty()) return AffineForm(domain);
+		AffineForm res(carl::center(domain));
+		I center(res.mCenter);
+		Number radius = std::max((I(domain.upper()) - center).upper(), (center - I(domain.lower())).upper());
+		if (radius > carl::constant_zero<Number>().get()) {
+			res.mDeviations.emplace(v, I(radius));
+		}
+		return res;
+	}
+
+	const I& center() const {
+		return mCenter;
+	}
+	const std::map<Variable, I>& deviations() const {
+		return mDeviations;
+	}
+	const I& error() const {
+		return mError;
+	}
+
+	/// Computes the interval enclosed by this form.
+	I to_interval() const {
+		return mCenter + symmetric(radius()) + mError;
+	}
+
+	AffineForm operator-() const {
+		AffineForm res(*this);
+		res.mCenter = -mCenter;
+		for (auto& d: res.mDeviations) {
+			d.second = -d.second;
+		}
+		res.mError = -mError;
+		return res;
+	}
+
+	AffineForm& operator+=(const AffineForm& rhs) {
+		mCenter += rhs.mCenter;
+		for (const auto& d: rhs.mDeviations) {
+			auto it = mDeviations.find(d.first);
+			if (it == mDeviations.end()) {
+				mDeviations.emplace(d.first, d.second);
+			} else {
+				it->second += d.second;
+			}
+		}
+		mError += rhs.mError;
+		return *this;
+	}
+	AffineForm& operator-=(const AffineForm& rhs) {
+		return *this += -rhs;
+	}
+
+	AffineForm operator*(const AffineForm& rhs) const {
+		if (mCenter.isUnbounded() || mError.isUnbounded() || rhs.mCenter.isUnbounded() || rhs.mError.isUnbounded()) {
+			return AffineForm(to_interval() * rhs.to_interval());
+		}
+		AffineForm res;
+		res.mCenter = mCenter * rhs.mCenter;
+		for (const auto& d: mDeviations) {
+			res.mDeviations.emplace(d.first, rhs.mCenter * d.second);
+		}
+		for (const auto& d: rhs.mDeviations) {
+			auto it = res.mDeviations.find(d.first);
+			if (it == res.mDeviations.end()) {
+				res.mDeviations.emplace(d.first, mCenter * d.second);
+			} else {
+				it->second += mCenter * d.second;
+			}
+		}
+		// (x_0 + X + E) (y_0 + Y + F) = x_0 y_0 + x_0 Y + y_0 X + X Y + (x_0 + X) F + (y_0 + Y) E + E F
+		res.mError = quadratic_part(*this, rhs)
+			+ (mCenter + symmetric(radius())) * rhs.mError
+			+ (rhs.mCenter + symmetric(rhs.radius())) * mError
+			+ mError * rhs.mError;
+		return res;
+	}
+
+	/// Evaluates the polynomial on the given intervals, the variables serve as noise symbols.
+	template<typename Coeff, typename Policy, typename Ordering>
+	static AffineForm evaluate(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const std::map<Variable, I>& map) {
+		return evaluate_polynomial(p, map);
+	}
+	/// Evaluates the polynomial on the given box, the variables serve as noise symbols.
+	template<typename Coeff, typename Policy, typename Ordering>
+	static AffineForm evaluate(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const IntervalBox<Number>& box) {
+		return evaluate_polynomial(p, box);
+	}
+};
+
+template<typename Number>
+inline AffineForm<Number> operator+(const AffineForm<Number>& lhs, const AffineForm<Number>& rhs) {
+	AffineForm<Number> res(lhs);
+	return res += rhs;
+}
+template<typename Number>
+inline AffineForm<Number> operator-(const AffineForm<Number>& lhs, const AffineForm<Number>& rhs) {
+	AffineForm<Number> res(lhs);
+	return res -= rhs;
+}
+
+template<typename Number>
+inline std::ostream& operator<<(std::ostream& os, const AffineForm<Number>& af) {
+	os << af.center();
+	for (const auto& d: af.deviations()) {
+		os << " + " << d.second << "*e_" << d.first;
+	}
+	return os << " + " << af.error();
+}
+
+}
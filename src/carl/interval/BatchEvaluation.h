@@ -0,0 +1,106 @@
+#pragma once
+
+#include "../formula/Constraint.h"
+#include "ExpressionDAG.h"
+#include "Interval.h"
+#include "IntervalBox.h"
+#include "evaluate.h"
+
+#include <boost/logic/tribool.hpp>
+
+#include <map>
+#include <optional>
+#include <vector>
+
+namespace carl {
+
+/**
+ * Evaluates a set of constraints on boxes, sharing the work for common subterms.
+ *
+ * The left hand sides of all constraints are stored in a single ExpressionDAG, hence every variable, every power of a variable and every monomial
+ * is evaluated only once per box, regardless of how many constraints contain it.
+ * The result consists of the interval of every left hand side and whether the constraint holds on the whole box (true),
+ * on no point of the box (false) or whether this can not be decided by interval arithmetic (indeterminate).
+ */
+template<typename Polynomial, typename Number = double>
+class BatchEvaluation {
+public:
+	/// The results of an evaluation, indexed like the constraints.
+	struct Result {
+		std::vector<Interval<Number>> values;
+		std::vector<boost::tribool> verdicts;
+	};
+
+private:
+	using DAG = contractor::ExpressionDAG<Polynomial, Number>;
+
+	struct ConstraintData {
+		Constraint<Polynomial> constraint;
+		/// The root of the left hand side without its constant part, if it is not constant.
+		std::optional<std::size_t> root;
+		Interval<Number> constant;
+	};
+
+	DAG mDAG;
+	std::vector<ConstraintData> mConstraints;
+
+public:
+	BatchEvaluation() = default;
+	explicit BatchEvaluation(const Constraints<Polynomial>& constraints) {
+		for (const auto& c: constraints) {
+			add(c);
+		}
+	}
+
+	/**
+	 * Adds a constraint.
+	 * @return The index of the constraint.
+	 */
+	std::size_t add(const Constraint<Polynomial>& c) {
+		typename DAG::Coeff constant;
+		auto root = mDAG.add(c.lhs(), constant);
+		mConstraints.push_back(ConstraintData{c, root, Interval<Number>(constant)});
+		return mConstraints.size() - 1;
+	}
+
+	std::size_t size() const {
+		return mConstraints.size();
+	}
+	const Constraint<Polynomial>& constraint(std::size_t id) const {
+		return mConstraints[id].constraint;
+	}
+	const DAG& dag() const {
+		return mDAG;
+	}
+
+	/**
+	 * Evaluates all constraints on the box.
+	 * @param box Box containing all variables of the constraints.
+	 * @param result Is set to the results, passing the same object repeatedly avoids reallocations.
+	 * @param values Values of the nodes of the graph, passing the same object repeatedly avoids reallocations.
+	 */
+	void evaluate(const IntervalBox<Number>& box, Result& result, std::vector<Interval<Number>>& values) const {
+		mDAG.forward(box, values);
+		result.values.resize(mConstraints.size());
+		result.verdicts.resize(mConstraints.size());
+		for (std::size_t i = 0; i < mConstraints.size(); ++i) {
+			const auto& c = mConstraints[i];
+			result.values[i] = c.root ? values[*c.root] + c.constant : c.constant;
+			result.verdicts[i] = carl::evaluate(result.values[i], c.constraint.relation());
+		}
+	}
+
+	/// Evaluates all constraints on the box, see above.
+	Result evaluate(const IntervalBox<Number>& box) const {
+		Result result;
+		std::vector<Interval<Number>> values;
+		evaluate(box, result, values);
+		return result;
+	}
+	/// Evaluates all constraints on the given intervals, see above.
+	Result evaluate(const std::map<Variable, Interval<Number>>& map) const {
+		return evaluate(IntervalBox<Number>(map));
+	}
+};
+
+}
@@ -0,0 +1,472 @@
+#pragma once
+
+#include "../core/MultivariatePolynomial.h"
+#include "../core/polynomialfunctions/Derivative.h"
+#include "../formula/Constraint.h"
+#include "BatchEvaluation.h"
+#include "ExpressionDAG.h"
+#include "HC4.h"
+#include "Interval.h"
+#include "IntervalBox.h"
+#include "IntervalNewton.h"
+#include "sampling.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace carl {
+
+/**
+ * Branch-and-prune search for solutions of a set of polynomial constraints within a box.
+ *
+ * Every box is first contracted by HC4 and, if the equalities form a square system, by the interval Newton operator.
+ * Boxes that are proven to contain no solution are pruned.
+ * A box is a witness if all constraints hold on the whole box, on its sample point, or if the interval Newton operator proved
+ * that it contains a unique solution of the equalities and all other constraints hold on the whole box.
+ * As this solution need not be integral, the interval Newton operator only serves for contraction if one of the variables of the equalities is integer.
+ * Otherwise, the box is split into two halves, unless all its intervals are smaller than the precision.
+ * Such a box is a witness if the interval Newton operator proves that a slightly inflated box contains a unique solution, and is reported as undecided otherwise.
+ * The variable to split is selected by one of the following heuristics:
+ * - LARGEST_WIDTH: the variable with the widest interval.
+ * - SMEAR: the variable maximizing the width of its interval times the magnitude of the partial derivative of some constraint (the smear value).
+ *
+ * The search may use multiple threads. Every thread owns a pool of boxes and processes its most recent box first (depth-first search).
+ * Idle threads steal the oldest box from the pool of another thread, hence boxes are never shared between threads.
+ * With a single thread, the search runs in the calling thread and is deterministic.
+ * As in IntervalNewton, intervals are over double.
+ */
+template<typename Polynomial>
+class BranchAndPrune {
+public:
+	using Number = double;
+
+	enum class Split { LARGEST_WIDTH, SMEAR };
+	enum class Answer { SAT, UNSAT, UNKNOWN };
+
+	struct Settings {
+		Split split = Split::SMEAR;
+		/// Boxes whose intervals are all at most this wide are not split any further.
+		double precision = 1e-6;
+		/// Stop as soon as a witness is found.
+		bool stop_on_witness = true;
+		/// Use the interval Newton operator if the equalities form a square system.
+		bool use_newton = true;
+		/// Number of threads.
+		std::size_t threads = 1;
+		/// Maximal number of boxes to process, zero means unlimited.
+		std::size_t max_boxes = 0;
+	};
+
+	struct Statistics {
+		/// Number of processed boxes.
+		std::size_t boxes = 0;
+		/// Number of boxes that were proven to contain no solution.
+		std::size_t pruned = 0;
+		/// Number of splits.
+		std::size_t splits = 0;
+		/// Number of boxes stolen from the pool of another thread.
+		std::size_t steals = 0;
+
+		Statistics& operator+=(const Statistics& rhs) {
+			boxes += rhs.boxes;
+			pruned += rhs.pruned;
+			splits += rhs.splits;
+			steals += rhs.steals;
+			return *this;
+		}
+	};
+
+	struct Result {
+		/// SAT if a witness was found, UNSAT if all boxes were pruned and UNKNOWN otherwise.
+		Answer answer = Answer::UNKNOWN;
+		std::optional<IntervalBox<Number>> witness;
+		/// The boxes that could neither be pruned nor split, and the boxes left when the search was stopped early.
+		std::vector<IntervalBox<Number>> undecided;
+		Statistics statistics;
+	};
+
+private:
+	using I = Interval<Number>;
+	using DAG = contractor::ExpressionDAG<Polynomial, Number>;
+
+	/// A partial derivative of the left hand side of a constraint.
+	struct Derivative {
+		std::size_t variable;
+		std::optional<std::size_t> root;
+		I constant;
+	};
+
+	/// The state of a single thread.
+	struct Worker {
+		std::deque<IntervalBox<Number>> pool;
+		std::mutex mutex;
+		contractor::HC4<Polynomial, Number> hc4;
+		std::optional<contractor::IntervalNewton<Polynomial>> newton;
+		typename BatchEvaluation<Polynomial, Number>::Result result;
+		std::vector<I> values;
+		std::vector<I> derivatives;
+		std::vector<IntervalBox<Number>> undecided;
+		Statistics statistics;
+
+		Worker(const contractor::HC4<Polynomial, Number>& hc4, const std::optional<contractor::IntervalNewton<Polynomial>>& newton):
+			hc4(hc4), newton(newton)
+		{}
+	};
+
+	/// The state shared by all threads of a single search.
+	struct Search {
+		std::vector<std::unique_ptr<Worker>> workers;
+		/// Number of boxes that are in some pool or currently processed.
+		std::atomic<std::size_t> pending{0};
+		std::atomic<std::size_t> processed{0};
+		std::atomic<bool> stop{false};
+		std::mutex witness_mutex;
+		std::optional<IntervalBox<Number>> witness;
+		/// The box to be searched.
+		IntervalBox<Number> domain;
+	};
+
+	Settings mSettings;
+	std::vector<Variable> mVariables;
+	BatchEvaluation<Polynomial, Number> mConstraints;
+	contractor::HC4<Polynomial, Number> mHC4;
+	std::optional<contractor::IntervalNewton<Polynomial>> mNewton;
+	/// Whether a unique solution proven by the interval Newton operator is a witness, which requires that none of its variables is integer.
+	bool mNewtonWitness = false;
+	/// The partial derivatives of all constraints, for the smear heuristic.
+	DAG mDerivativeDAG;
+	std::vector<Derivative> mDerivatives;
+
+	static Number width(const I& i) {
+		return i.isUnbounded() ? std::numeric_limits<Number>::infinity() : i.diameter();
+	}
+
+	/// Selects the variable to split, returns mVariables.size() if all intervals are smaller than the precision.
+	std::size_t select(const IntervalBox<Number>& box, Worker& worker) const {
+		std::vector<Number> score(mVariables.size(), 0);
+		for (std::size_t i = 0; i < mVariables.size(); ++i) {
+			score[i] = width(box.at(mVariables[i]));
+		}
+		if (mSettings.split == Split::SMEAR) {
+			std::vector<Number> smear(mVariables.size(), 0);
+			mDerivativeDAG.forward(box, worker.derivatives);
+			for (const auto& d: mDerivatives) {
+				I value = d.root ? worker.derivatives[*d.root] + d.constant : d.constant;
+				Number s = std::isinf(score[d.variable]) ? score[d.variable] : (value.isUnbounded() ? std::numeric_limits<Number>::infinity() : value.magnitude() * score[d.variable]);
+				smear[d.variable] = std::max(smear[d.variable], s);
+			}
+			for (std::size_t i = 0; i < mVariables.size(); ++i) {
+				// Variables that no constraint depends on are split last.
+				if (score[i] > mSettings.precision) score[i] = smear[i];
+			}
+		}
+		std::size_t best = mVariables.size();
+		for (std::size_t i = 0; i < mVariables.size(); ++i) {
+			if (width(box.at(mVariables[i])) <= mSettings.precision) continue;
+			if (best == mVariables.size() || score[i] > score[best]) best = i;
+		}
+		return best;
+	}
+
+	/// Splits the interval of the given variable, returns false if it can not be split.
+	static bool split(const IntervalBox<Number>& box, Variable v, IntervalBox<Number>& left, IntervalBox<Number>& right) {
+		const I& i = box.at(v);
+		Number mid = carl::center(i);
+		I lower;
+		I upper;
+		if (v.type() == VariableType::VT_INT) {
+			mid = carl::floor(mid);
+			if (i.upperBoundType() != BoundType::INFTY && mid >= i.upper()) mid = i.upper() - 1;
+			lower = I(i.lower(), i.lowerBoundType(), mid, BoundType::WEAK);
+			upper = I(mid + 1, BoundType::WEAK, i.upper(), i.upperBoundType());
+		} else {
+			lower = I(i.lower(), i.lowerBoundType(), mid, BoundType::WEAK);
+			upper = I(mid, BoundType::WEAK, i.upper(), i.upperBoundType());
+		}
+		// Compare the bounds exactly, operator== only compares doubles up to a few ulps.
+		auto same = [&i](const I& j) {
+			return j.lower() == i.lower() && j.lowerBoundType() == i.lowerBoundType() && j.upper() == i.upper() && j.upperBoundType() == i.upperBoundType();
+		};
+		if (lower.isEmpty() || upper.isEmpty() || same(lower) || same(upper)) return false;
+		left = box;
+		left.insert_or_assign(v, lower);
+		right = box;
+		right.insert_or_assign(v, upper);
+		return true;
+	}
+
+	/// Restricts the intervals of integer variables to their integral parts, returns false if one of them becomes empty.
+	bool round_integers(IntervalBox<Number>& box) const {
+		for (Variable v: mVariables) {
+			if (v.type() != VariableType::VT_INT) continue;
+			I i = box.at(v).integralPart();
+			if (i.isEmpty()) return false;
+			box.insert_or_assign(v, i);
+		}
+		return true;
+	}
+
+	/// Checks whether all constraints hold on the sample point of the box.
+	bool check_sample(const IntervalBox<Number>& box, Worker& worker, IntervalBox<Number>& point) const {
+		point = box;
+		for (Variable v: mVariables) {
+			Number s = carl::sample(box.at(v));
+			if (v.type() == VariableType::VT_INT && carl::floor(s) != s) return false;
+			point.insert_or_assign(v, I(s));
+		}
+		mConstraints.evaluate(point, worker.result, worker.values);
+		for (const auto& verdict: worker.result.verdicts) {
+			if (boost::indeterminate(verdict) || !verdict) return false;
+		}
+		return true;
+	}
+
+	/**
+	 * Tries to prove that a box that is too small to be split contains a solution.
+	 * Contraction usually shrinks such boxes so far that the interval Newton operator can not map them into their interior,
+	 * hence the box is inflated first (epsilon-inflation). The solution must still lie within the searched domain.
+	 */
+	bool verify(const IntervalBox<Number>& box, Worker& worker, const Search& search, IntervalBox<Number>& inflated) const {
+		if (!worker.newton || !mNewtonWitness) return false;
+		inflated = box;
+		for (Variable v: worker.newton->variables()) {
+			const I& i = box.at(v);
+			if (i.isUnbounded()) return false;
+			Number radius = std::max(i.diameter(), mSettings.precision);
+			inflated.insert_or_assign(v, I(i.lower() - radius, i.upper() + radius));
+		}
+		if (!worker.newton->contract(inflated) || !worker.newton->unique_solution()) return false;
+		for (Variable v: worker.newton->variables()) {
+			if (!search.domain.at(v).contains(inflated.at(v))) return false;
+		}
+		mConstraints.evaluate(inflated, worker.result, worker.values);
+		for (std::size_t i = 0; i < mConstraints.size(); ++i) {
+			if (mConstraints.constraint(i).relation() == Relation::EQ) continue;
+			const auto& verdict = worker.result.verdicts[i];
+			if (boost::indeterminate(verdict) || !verdict) return false;
+		}
+		return true;
+	}
+
+	void found_witness(Search& search, const IntervalBox<Number>& box) const {
+		std::lock_guard<std::mutex> lock(search.witness_mutex);
+		if (!search.witness) search.witness = box;
+		if (mSettings.stop_on_witness) search.stop = true;
+	}
+
+	/**
+	 * Processes a single box.
+	 * Boxes resulting from a split are counted as pending before they are added to the pool of the worker, where they may be stolen immediately.
+	 */
+	void process(IntervalBox<Number>& box, Worker& worker, Search& search) const {
+		++worker.statistics.boxes;
+		if (!worker.hc4.contract(box)) {
+			++worker.statistics.pruned;
+			return;
+		}
+		bool unique = false;
+		if (worker.newton) {
+			if (!worker.newton->contract(box)) {
+				++worker.statistics.pruned;
+				return;
+			}
+			// The interval Newton operator only proves a unique real solution.
+			unique = mNewtonWitness && worker.newton->unique_solution();
+		}
+		// The contractors are not aware of integer variables.
+		if (!round_integers(box)) {
+			++worker.statistics.pruned;
+			return;
+		}
+		mConstraints.evaluate(box, worker.result, worker.values);
+		bool all = true;
+		for (std::size_t i = 0; i < mConstraints.size(); ++i) {
+			const auto& verdict = worker.result.verdicts[i];
+			if (!verdict) {
+				++worker.statistics.pruned;
+				return;
+			}
+			if (boost::indeterminate(verdict)) {
+				all = false;
+				// The interval Newton operator only proves that the equalities have a solution.
+				if (mConstraints.constraint(i).relation() != Relation::EQ) unique = false;
+			}
+		}
+		if (all || unique) {
+			CARL_LOG_DEBUG("carl.contractor", "Found witness " << box);
+			found_witness(search, box);
+			return;
+		}
+		IntervalBox<Number> point;
+		if (check_sample(box, worker, point)) {
+			CARL_LOG_DEBUG("carl.contractor", "Found witness " << point);
+			found_witness(search, point);
+			if (mSettings.stop_on_witness) return;
+		}
+		std::size_t var = select(box, worker);
+		IntervalBox<Number> left;
+		IntervalBox<Number> right;
+		if (var == mVariables.size() || !split(box, mVariables[var], left, right)) {
+			if (verify(box, worker, search, point)) {
+				CARL_LOG_DEBUG("carl.contractor", "Found witness " << point);
+				found_witness(search, point);
+			} else {
+				worker.undecided.emplace_back(std::move(box));
+			}
+			return;
+		}
+		++worker.statistics.splits;
+		std::lock_guard<std::mutex> lock(worker.mutex);
+		search.pending += 2;
+		// The left half is processed next.
+		worker.pool.emplace_back(std::move(right));
+		worker.pool.emplace_back(std::move(left));
+	}
+
+	/// Takes the next box of the own pool or steals one from another thread.
+	bool next(std::size_t id, Search& search, IntervalBox<Number>& box) const {
+		Worker& worker = *search.workers[id];
+		{
+			std::lock_guard<std::mutex> lock(worker.mutex);
+			if (!worker.pool.empty()) {
+				box = std::move(worker.pool.back());
+				worker.pool.pop_back();
+				return true;
+			}
+		}
+		for (std::size_t i = 1; i < search.workers.size(); ++i) {
+			Worker& victim = *search.workers[(id + i) % search.workers.size()];
+			std::lock_guard<std::mutex> lock(victim.mutex);
+			if (!victim.pool.empty()) {
+				box = std::move(victim.pool.front());
+				victim.pool.pop_front();
+				++worker.statistics.steals;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void run(std::size_t id, Search& search) const {
+		IntervalBox<Number> box;
+		while (!search.stop && search.pending > 0) {
+			if (!next(id, search, box)) {
+				std::this_thread::yield();
+				continue;
+			}
+			if (mSettings.max_boxes > 0 && search.processed++ >= mSettings.max_boxes) {
+				search.workers[id]->undecided.emplace_back(std::move(box));
+				search.stop = true;
+				--search.pending;
+				break;
+			}
+			process(box, *search.workers[id], search);
+			assert(search.pending > 0);
+			--search.pending;
+		}
+	}
+
+public:
+	/**
+	 * Constructs the solver for the conjunction of the given constraints.
+	 */
+	explicit BranchAndPrune(const Constraints<Polynomial>& constraints, const Settings& settings = Settings()):
+		mSettings(settings),
+		mConstraints(constraints),
+		mHC4(constraints)
+	{
+		assert(mSettings.threads > 0);
+		carlVariables vars;
+		std::vector<Polynomial> equations;
+		carlVariables equation_vars;
+		for (const auto& c: constraints) {
+			carl::variables(c.lhs(), vars);
+			if (c.relation() == Relation::EQ) {
+				equations.push_back(c.lhs());
+				carl::variables(c.lhs(), equation_vars);
+			}
+		}
+		mVariables.assign(vars.begin(), vars.end());
+		if (mSettings.use_newton && !equations.empty() && equations.size() == equation_vars.size()) {
+			mNewton.emplace(equations, std::vector<Variable>(equation_vars.begin(), equation_vars.end()));
+			mNewtonWitness = std::none_of(equation_vars.begin(), equation_vars.end(), [](Variable v){ return v.type() == VariableType::VT_INT; });
+		}
+		for (const auto& c: constraints) {
+			for (std::size_t i = 0; i < mVariables.size(); ++i) {
+				if (!c.lhs().has(mVariables[i])) continue;
+				Derivative d{i, std::nullopt, I(0)};
+				typename DAG::Coeff constant;
+				d.root = mDerivativeDAG.add(carl::derivative(c.lhs(), mVariables[i]), constant);
+				d.constant = I(constant);
+				mDerivatives.push_back(d);
+			}
+		}
+	}
+
+	const Settings& settings() const {
+		return mSettings;
+	}
+	const std::vector<Variable>& variables() const {
+		return mVariables;
+	}
+
+	/**
+	 * Searches the given box for solutions.
+	 * Variables that are not assigned in the box are considered unbounded.
+	 */
+	Result solve(const IntervalBox<Number>& box) const {
+		Search search;
+		for (std::size_t i = 0; i < mSettings.threads; ++i) {
+			search.workers.emplace_back(std::make_unique<Worker>(mHC4, mNewton));
+		}
+		IntervalBox<Number> initial = box;
+		for (Variable v: mVariables) {
+			if (initial.count(v) == 0) initial.insert_or_assign(v, I::unboundedInterval());
+		}
+		search.domain = initial;
+		search.workers.front()->pool.emplace_back(std::move(initial));
+		search.pending = 1;
+		if (mSettings.threads == 1) {
+			run(0, search);
+		} else {
+			std::vector<std::thread> threads;
+			for (std::size_t i = 0; i < mSettings.threads; ++i) {
+				threads.emplace_back([this, i, &search]() { run(i, search); });
+			}
+			for (auto& t: threads) {
+				t.join();
+			}
+		}
+
+		Result result;
+		result.witness = std::move(search.witness);
+		for (const auto& w: search.workers) {
+			result.statistics += w->statistics;
+			std::move(w->undecided.begin(), w->undecided.end(), std::back_inserter(result.undecided));
+			// If the search was stopped early, the boxes left in the pools are undecided.
+			std::move(w->pool.begin(), w->pool.end(), std::back_inserter(result.undecided));
+		}
+		if (result.witness) {
+			result.answer = Answer::SAT;
+		} else if (result.undecided.empty()) {
+			result.answer = Answer::UNSAT;
+		} else {
+			result.answer = Answer::UNKNOWN;
+		}
+		return result;
+	}
+	/// Searches the given intervals for solutions, see above.
+	Result solve(const std::map<Variable, I>& map) const {
+		return solve(IntervalBox<Number>(map));
+	}
+};
+
+}
@@ -7,9 +7,10 @@
 
 #pragma once
 #include "Interval.h"
+#include "IntervalBox.h"
 #include "set_theory.h"
 #include "../core/Sign.h"
-#include "../core/MultivariateHorner.h"
+#include "../core/MultivariateHornerCache.h"
 #include "IntervalEvaluation.h"
 #include <algorithm>
 
@@ -194,10 +195,23 @@ namespace carl {
              * @return true, if the second interval is not empty. (the first interval must then be also nonempty)
              */
             std::vector<Interval<double>> evaluate(const Interval<double>::evalintervalmap& intervals) const
+            {
+                return evaluate_on(intervals);
+            }
+
+            /// Evaluates this solution formula for the given box, see above.
+            std::vector<Interval<double>> evaluate(const IntervalBox<double>& intervals) const
+            {
+                return evaluate_on(intervals);
+            }
+
+        private:
+            template<typename Assignment>
+            std::vector<Interval<double>> evaluate_on(const Assignment& intervals) const
             {
                 // evaluate monomial
                 std::vector<Interval<double>> result;
-                assert( intervals.find(mVar) != intervals.end() );
+                assert( intervals.count(mVar) > 0 );
                 const Interval<double>& varInterval = intervals.at(mVar);
                 Interval<double> numerator = IntervalEvaluation::evaluate(mNumerator, intervals);
 				CARL_LOG_DEBUG("carl.contraction", mNumerator << " -> " << numerator);
@@ -244,14 +258,8 @@ namespace carl {
     private:
         Polynomial mConstraint; // Todo: Should be a reference.
         Polynomial* mpOriginal;
-        #ifdef USE_HORNER
-        MultivariateHorner<Polynomial, strategy> mHornerForm;
-        std::map<Variable, MultivariateHorner<Polynomial,strategy>> mDerivatives;
-        #else
         std::map<Variable, Polynomial> mDerivatives;
-        #endif
         std::map<Variable, VarSolutionFormula<Polynomial>> mVarSolutionFormulas;
-        std::map<Polynomial, MultivariateHorner<Polynomial,strategy>> mHornerSchemes;
 
     public:
         Contraction() = delete;
@@ -259,24 +267,16 @@ namespace carl {
 			Operator<Polynomial>(),
             mConstraint(constraint),
             mpOriginal(nullptr),
-            #ifdef USE_HORNER
-            mHornerForm(constraint),
-            #endif
             mDerivatives(),
-            mVarSolutionFormulas(),
-			mHornerSchemes()
+            mVarSolutionFormulas()
         {}
 
         Contraction(const Polynomial& constraint, const Polynomial& _original ):
 			Operator<Polynomial>(),
             mConstraint(constraint),
             mpOriginal (_original.isLinear() ? nullptr : new Polynomial(_original)),
-            #ifdef USE_HORNER
-            mHornerForm( mpOriginal == nullptr ? constraint :  _original ),
-            #endif
             mDerivatives(),
-            mVarSolutionFormulas() ,
-			mHornerSchemes()
+            mVarSolutionFormulas()
         {}
         Contraction(const Contraction&) = delete;
         
@@ -284,12 +284,8 @@ namespace carl {
 			Operator<Polynomial>(),
             mConstraint(std::move(_contraction.mConstraint)),
             mpOriginal(_contraction.mpOriginal),
-            #ifdef USE_HORNER
-            mHornerForm(std::move(_contraction.mHornerForm)),
-            #endif
             mDerivatives(std::move(_contraction.mDerivatives)),
-            mVarSolutionFormulas(std::move(_contraction.mVarSolutionFormulas)),
-			mHornerSchemes(std::move(_contraction.mHornerSchemes))
+            mVarSolutionFormulas(std::move(_contraction.mVarSolutionFormulas))
         {
             _contraction.mpOriginal = nullptr;
         }
@@ -309,30 +305,30 @@ namespace carl {
         }
 
         bool operator()(const Interval<double>::evalintervalmap& intervals, Variable::Arg variable, Interval<double>& resA, Interval<double>& resB, bool useNiceCenter = false, bool usePropagation = false)
+        {
+            return contract_on(intervals, variable, resA, resB, useNiceCenter, usePropagation);
+        }
+
+        bool operator()(const IntervalBox<double>& intervals, Variable::Arg variable, Interval<double>& resA, Interval<double>& resB, bool useNiceCenter = false, bool usePropagation = false)
+        {
+            return contract_on(intervals, variable, resA, resB, useNiceCenter, usePropagation);
+        }
+
+    private:
+        template<typename Assignment>
+        bool contract_on(const Assignment& intervals, Variable::Arg variable, Interval<double>& resA, Interval<double>& resB, bool useNiceCenter, bool usePropagation)
         {
             bool splitOccurredInContraction = false;
             if( !usePropagation || mpOriginal == nullptr || !mConstraint.isLinear() )
             {
-                #ifdef USE_HORNER
-                typename std::map<Variable, MultivariateHorner<Polynomial,strategy>>::const_iterator it = mDerivatives.find(variable);
-                #else
                 typename std::map<Variable, Polynomial>::const_iterator it = mDerivatives.find(variable);
-                #endif
 
                 if( it == mDerivatives.end() )
                 {
-                    #ifdef USE_HORNER
-                    //Deriviate and convert to Horner
-                    if( mpOriginal == nullptr )
-                        it = mDerivatives.emplace(variable, std::move(MultivariateHorner<Polynomial, strategy>( mConstraint.derivative(variable)))).first;
-                    else
-                        it = mDerivatives.emplace(variable, std::move(MultivariateHorner<Polynomial, strategy>( mpOriginal->derivative(variable)))).first;
-                    #else
                     if( mpOriginal == nullptr )
                         it = mDerivatives.emplace(variable, derivative(mConstraint, variable)).first;
                     else
                         it = mDerivatives.emplace(variable, derivative(*mpOriginal, variable)).first;
-                    #endif
                 }
 
                 #ifdef CONTRACTION_DEBUG
@@ -340,7 +336,11 @@ namespace carl {
                 #endif
 
                 #ifdef USE_HORNER
-                splitOccurredInContraction = Operator<Polynomial>::contract(intervals, variable, mHornerForm, (*it).second, resA, resB, useNiceCenter);
+                // The Horner schemes are shared between all contractions and only rebuilt if the intervals changed significantly.
+                auto& hornerCache = MultivariateHornerCache<Polynomial, strategy>::getInstance();
+                auto hornerForm = hornerCache.get(polynomial(), intervals);
+                auto hornerDerivative = hornerCache.get((*it).second, intervals);
+                splitOccurredInContraction = Operator<Polynomial>::contract(intervals, variable, *hornerForm, *hornerDerivative, resA, resB, useNiceCenter);
                 #else
                 splitOccurredInContraction = Operator<Polynomial>::contract(intervals, variable, (mpOriginal == nullptr ? mConstraint : *mpOriginal), (*it).second, resA, resB, useNiceCenter);
                 #endif
@@ -490,8 +490,9 @@ namespace carl {
     class SimpleNewton {
     public:
         
-        template <typename evalType>
-        bool contract(const Interval<double>::evalintervalmap& intervals, 
+        /// Works on both std::map and IntervalBox as the assignment.
+        template <typename evalType, typename Assignment>
+        bool contract(const Assignment& intervals, 
             Variable::Arg variable, 
             const evalType& constraint, 
             const evalType& derivative, 
@@ -517,8 +518,8 @@ namespace carl {
 			#endif
 			
             // Create map for replacement of variables by intervals and replacement of center by point interval
-            typename Interval<double>::evalintervalmap substitutedIntervalMap = intervals;
-            substitutedIntervalMap[variable] = centerInterval;
+            Assignment substitutedIntervalMap = intervals;
+            substitutedIntervalMap.insert_or_assign(variable, centerInterval);
 
             Interval<double> numerator (0);
             Interval<double> denominator(0);
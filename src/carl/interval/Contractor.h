@@ -4,6 +4,7 @@
 #include "../core/Variables.h"
 #include "../formula/Constraint.h"
 #include "Interval.h"
+#include "IntervalBox.h"
 #include "IntervalEvaluation.h"
 #include "set_theory.h"
 
@@ -135,6 +136,16 @@ public:
 	 */
 	template<typename Number>
 	std::vector<Interval<Number>> evaluate(const std::map<Variable, Interval<Number>>& assignment, const Interval<Number>& h = Interval<Number>(0,0)) const {
+		return evaluate_on(assignment, h);
+	}
+	/// Evaluate this contraction over the given box, see above.
+	template<typename Number>
+	std::vector<Interval<Number>> evaluate(const IntervalBox<Number>& assignment, const Interval<Number>& h = Interval<Number>(0,0)) const {
+		return evaluate_on(assignment, h);
+	}
+private:
+	template<typename Number, typename Assignment>
+	std::vector<Interval<Number>> evaluate_on(const Assignment& assignment, const Interval<Number>& h) const {
 		std::vector<Interval<Number>> res;
 		CARL_LOG_DEBUG("carl.contractor", "Evaluating on " << assignment);
 		auto num = IntervalEvaluation::evaluate(numerator(), assignment);
@@ -232,11 +243,24 @@ public:
 		CARL_LOG_DEBUG("carl.contractor", "Evaluating " << mEvaluation << " on " << assignment);
 		return mEvaluation.evaluate(assignment, mRelation);
 	}
+	std::vector<Interval<Number>> evaluate(const IntervalBox<Number>& assignment) const {
+		CARL_LOG_DEBUG("carl.contractor", "Evaluating " << mEvaluation << " on " << assignment);
+		return mEvaluation.evaluate(assignment, mRelation);
+	}
 
 	std::vector<Interval<Number>> contract(const std::map<Variable, Interval<Number>>& assignment) const {
+		return contract_on(assignment);
+	}
+	std::vector<Interval<Number>> contract(const IntervalBox<Number>& assignment) const {
+		return contract_on(assignment);
+	}
+
+private:
+	template<typename Assignment>
+	std::vector<Interval<Number>> contract_on(const Assignment& assignment) const {
 		auto res = evaluate(assignment);
-		assert(assignment.find(mEvaluation.var()) != assignment.end());
-		auto cur = assignment.find(mEvaluation.var())->second;
+		assert(assignment.count(mEvaluation.var()) > 0);
+		const auto& cur = assignment.at(mEvaluation.var());
 		CARL_LOG_DEBUG("carl.contractor", "Intersecting " << res << " with " << cur);
 
 		std::size_t last = 0;
@@ -0,0 +1,281 @@
+#pragma once
+
+#include "../core/MultivariatePolynomial.h"
+#include "Interval.h"
+#include "IntervalBox.h"
+#include "power.h"
+#include "set_theory.h"
+
+#include <map>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace carl {
+namespace contractor {
+
+/**
+ * Represents a set of polynomials as a directed acyclic graph, such that common subexpressions are shared.
+ *
+ * Every polynomial is a sum of products of powers of variables.
+ * Nodes are created bottom-up and merged if they are structurally equal, hence every variable, every power of a variable
+ * and every monomial occurs only once, regardless of how many polynomials contain it.
+ * The constant part of a polynomial is not part of the graph but returned separately by add(),
+ * such that polynomials only differing in their constant part share the same root node.
+ *
+ * Children always have smaller indices than their parents, hence iterating over the nodes by increasing index
+ * is a topological order, as needed for evaluating the graph (forward()), and iterating backwards allows to
+ * project the values of parents to their children (backward()), which is the core of HC4Revise.
+ */
+template<typename Polynomial, typename Number = double>
+class ExpressionDAG {
+public:
+	using Coeff = typename Polynomial::CoeffType;
+
+	enum class NodeType { VARIABLE, POWER, PRODUCT, SUM };
+
+	struct Node {
+		NodeType type;
+		/// The variable of a VARIABLE node.
+		Variable variable;
+		/// The exponent of a POWER node.
+		std::size_t exponent;
+		/// The children, i.e. the base of a POWER node, the factors of a PRODUCT node or the summands of a SUM node.
+		std::vector<std::size_t> children;
+		/// The coefficients of the summands of a SUM node.
+		std::vector<Coeff> coefficients;
+		/// The coefficients of a SUM node converted to intervals.
+		std::vector<Interval<Number>> coefficient_intervals;
+	};
+
+private:
+	using Key = std::tuple<NodeType, Variable, std::size_t, std::vector<std::size_t>, std::vector<Coeff>>;
+
+	std::vector<Node> mNodes;
+	std::map<Key, std::size_t> mIndex;
+
+	std::size_t get_node(Node&& node) {
+		Key key(node.type, node.variable, node.exponent, node.children, node.coefficients);
+		auto it = mIndex.find(key);
+		if (it != mIndex.end()) return it->second;
+		for (const auto& c: node.coefficients) {
+			node.coefficient_intervals.emplace_back(c);
+		}
+		mNodes.emplace_back(std::move(node));
+		mIndex.emplace(std::move(key), mNodes.size() - 1);
+		return mNodes.size() - 1;
+	}
+
+	std::size_t add_monomial(const Monomial& m) {
+		std::vector<std::size_t> factors;
+		for (const auto& [var, exp]: m) {
+			std::size_t v = get_node(Node{NodeType::VARIABLE, var, 0, {}, {}, {}});
+			if (exp == 1) {
+				factors.push_back(v);
+			} else {
+				factors.push_back(get_node(Node{NodeType::POWER, Variable::NO_VARIABLE, exp, {v}, {}, {}}));
+			}
+		}
+		if (factors.size() == 1) return factors.front();
+		return get_node(Node{NodeType::PRODUCT, Variable::NO_VARIABLE, 0, std::move(factors), {}, {}});
+	}
+
+	/// Intersects the value of a node with the given interval, returns false if the result is empty.
+	static bool restrict(Interval<Number>& value, const Interval<Number>& i) {
+		value = set_intersection(value, i);
+		return !value.isEmpty();
+	}
+
+	/// Intersects the value of a node with a quotient, which may consist of two intervals.
+	static bool restrict_quotient(Interval<Number>& value, const Interval<Number>& numerator, const Interval<Number>& denominator) {
+		Interval<Number> resA;
+		Interval<Number> resB;
+		if (numerator.div_ext(denominator, resA, resB)) {
+			return restrict(value, hull(set_intersection(value, resA), set_intersection(value, resB)));
+		}
+		return restrict(value, resA);
+	}
+
+	/// Computes the smallest interval containing both intervals.
+	static Interval<Number> hull(const Interval<Number>& a, const Interval<Number>& b) {
+		if (a.isEmpty()) return b;
+		if (b.isEmpty()) return a;
+		Interval<Number> resA;
+		Interval<Number> resB;
+		if (set_union(a, b, resA, resB)) {
+			return Interval<Number>(resA.lowerBound(), resB.upperBound());
+		}
+		return resA;
+	}
+
+	/// Evaluates a single node, assumes that its children have been evaluated.
+	void forward_node(std::size_t id, const IntervalBox<Number>& box, std::vector<Interval<Number>>& values) const {
+		const Node& n = mNodes[id];
+		switch (n.type) {
+			case NodeType::VARIABLE:
+				values[id] = box.at(n.variable);
+				break;
+			case NodeType::POWER:
+				values[id] = carl::pow(values[n.children.front()], n.exponent);
+				break;
+			case NodeType::PRODUCT:
+				values[id] = values[n.children.front()];
+				for (std::size_t i = 1; i < n.children.size(); ++i) {
+					values[id] *= values[n.children[i]];
+				}
+				break;
+			case NodeType::SUM:
+				values[id] = n.coefficient_intervals.front() * values[n.children.front()];
+				for (std::size_t i = 1; i < n.children.size(); ++i) {
+					values[id] += n.coefficient_intervals[i] * values[n.children[i]];
+				}
+				break;
+		}
+	}
+
+public:
+	/**
+	 * Adds a polynomial to the graph.
+	 * @param p Polynomial.
+	 * @param constant Is set to the constant part of p.
+	 * @return The node representing p without its constant part, or std::nullopt if p is constant.
+	 */
+	std::optional<std::size_t> add(const Polynomial& p, Coeff& constant) {
+		constant = p.constantPart();
+		std::vector<std::size_t> summands;
+		std::vector<Coeff> coefficients;
+		for (const auto& t: p) {
+			if (!t.monomial()) continue;
+			summands.push_back(add_monomial(*t.monomial()));
+			coefficients.push_back(t.coeff());
+		}
+		if (summands.empty()) return std::nullopt;
+		return get_node(Node{NodeType::SUM, Variable::NO_VARIABLE, 0, std::move(summands), std::move(coefficients), {}});
+	}
+
+	const std::vector<Node>& nodes() const {
+		return mNodes;
+	}
+	const Node& operator[](std::size_t id) const {
+		return mNodes[id];
+	}
+	std::size_t size() const {
+		return mNodes.size();
+	}
+
+	/**
+	 * Collects the nodes reachable from the given node, sorted by their indices.
+	 */
+	std::vector<std::size_t> reachable(std::size_t root) const {
+		std::vector<bool> seen(mNodes.size(), false);
+		std::vector<std::size_t> stack({root});
+		seen[root] = true;
+		while (!stack.empty()) {
+			std::size_t cur = stack.back();
+			stack.pop_back();
+			for (std::size_t c: mNodes[cur].children) {
+				if (!seen[c]) {
+					seen[c] = true;
+					stack.push_back(c);
+				}
+			}
+		}
+		std::vector<std::size_t> res;
+		for (std::size_t i = 0; i < seen.size(); ++i) {
+			if (seen[i]) res.push_back(i);
+		}
+		return res;
+	}
+
+	/**
+	 * Evaluates the given nodes on the box.
+	 * @param nodes Nodes sorted by their indices, the children of every node must be contained.
+	 * @param box Box containing all variables.
+	 * @param values Values of all nodes, only the given nodes are updated.
+	 */
+	void forward(const std::vector<std::size_t>& nodes, const IntervalBox<Number>& box, std::vector<Interval<Number>>& values) const {
+		assert(values.size() == mNodes.size());
+		for (std::size_t id: nodes) {
+			forward_node(id, box, values);
+		}
+	}
+
+	/**
+	 * Evaluates all nodes on the box.
+	 * @param box Box containing all variables.
+	 * @param values Values of all nodes, is resized if necessary.
+	 */
+	void forward(const IntervalBox<Number>& box, std::vector<Interval<Number>>& values) const {
+		values.resize(mNodes.size());
+		for (std::size_t id = 0; id < mNodes.size(); ++id) {
+			forward_node(id, box, values);
+		}
+	}
+
+	/**
+	 * Projects the values of the given nodes to their children and finally to the variables in the box.
+	 * The values must stem from forward() and the values of the roots may have been restricted afterwards.
+	 * @param nodes Nodes sorted by their indices, the children of every node must be contained.
+	 * @param values Values of all nodes.
+	 * @param box Box whose intervals are intersected with the projections.
+	 * @return False if some projection is empty, i.e. the restrictions of the roots are infeasible within the box.
+	 */
+	bool backward(const std::vector<std::size_t>& nodes, std::vector<Interval<Number>>& values, IntervalBox<Number>& box) const {
+		for (auto it = nodes.rbegin(); it != nodes.rend(); ++it) {
+			const Node& n = mNodes[*it];
+			const Interval<Number>& value = values[*it];
+			switch (n.type) {
+				case NodeType::VARIABLE: {
+					Interval<Number> res = set_intersection(box.at(n.variable), value);
+					if (n.variable.type() == VariableType::VT_INT) res = res.integralPart();
+					if (res.isEmpty()) return false;
+					box.insert_or_assign(n.variable, res);
+					break;
+				}
+				case NodeType::POWER: {
+					Interval<Number>& base = values[n.children.front()];
+					Interval<Number> root = value.root(static_cast<int>(n.exponent));
+					if (n.exponent % 2 == 0) {
+						root = hull(set_intersection(base, root), set_intersection(base, -root));
+					}
+					if (!restrict(base, root)) return false;
+					break;
+				}
+				case NodeType::PRODUCT: {
+					// The product of all factors but the i'th one is prefix[i] * suffix[i+1].
+					std::size_t size = n.children.size();
+					std::vector<Interval<Number>> suffix(size + 1, Interval<Number>(1));
+					for (std::size_t i = size; i-- > 0;) {
+						suffix[i] = suffix[i + 1] * values[n.children[i]];
+					}
+					Interval<Number> prefix(1);
+					for (std::size_t i = 0; i < size; ++i) {
+						Interval<Number>& factor = values[n.children[i]];
+						if (!restrict_quotient(factor, value, prefix * suffix[i + 1])) return false;
+						prefix *= factor;
+					}
+					break;
+				}
+				case NodeType::SUM: {
+					// The sum of all summands but the i'th one is prefix[i] + suffix[i+1].
+					std::size_t size = n.children.size();
+					std::vector<Interval<Number>> suffix(size + 1, Interval<Number>(0));
+					for (std::size_t i = size; i-- > 0;) {
+						suffix[i] = suffix[i + 1] + n.coefficient_intervals[i] * values[n.children[i]];
+					}
+					Interval<Number> prefix(0);
+					for (std::size_t i = 0; i < size; ++i) {
+						Interval<Number>& summand = values[n.children[i]];
+						if (!restrict_quotient(summand, value - prefix - suffix[i + 1], n.coefficient_intervals[i])) return false;
+						prefix += n.coefficient_intervals[i] * summand;
+					}
+					break;
+				}
+			}
+		}
+		return true;
+	}
+};
+
+}
+}
@@ -0,0 +1,230 @@
+#pragma once
+
+#include "../formula/Constraint.h"
+#include "ExpressionDAG.h"
+#include "Interval.h"
+#include "IntervalBox.h"
+#include "set_theory.h"
+
+#include <deque>
+#include <map>
+#include <vector>
+
+namespace carl {
+namespace contractor {
+
+/**
+ * Forward-backward constraint propagation (HC4) for a set of polynomial constraints.
+ *
+ * The left hand sides of all constraints are stored in a single ExpressionDAG, hence subexpressions that occur in multiple constraints are shared.
+ * A single constraint is revised by HC4Revise: the expression is evaluated on the current box (forward),
+ * its value is intersected with the interval admitted by the relation, and the result is projected back to the variables (backward).
+ * contract() revises constraints in an AC3-style propagation loop:
+ * whenever the interval of a variable shrinks significantly, all other constraints containing this variable are revised again,
+ * until a fixpoint is reached or the box is found to be infeasible.
+ * A change is significant if a bound moves by more than epsilon times the width of the interval (or the magnitude of the bound, if the interval is unbounded).
+ */
+template<typename Polynomial, typename Number = double>
+class HC4 {
+public:
+	/// Statistics on the revisions of a single constraint.
+	struct ConstraintStatistics {
+		/// Number of revisions.
+		std::size_t revisions = 0;
+		/// Number of revisions that changed the box significantly.
+		std::size_t contractions = 0;
+		/// Number of revisions that proved the box to be infeasible.
+		std::size_t conflicts = 0;
+	};
+
+private:
+	using DAG = ExpressionDAG<Polynomial, Number>;
+
+	struct ConstraintData {
+		Constraint<Polynomial> constraint;
+		/// The root of the left hand side without its constant part, if it is not constant.
+		std::optional<std::size_t> root;
+		/// The admissible values of the root.
+		Interval<Number> target;
+		/// The nodes reachable from the root, sorted by their indices.
+		std::vector<std::size_t> nodes;
+		std::vector<Variable> variables;
+		ConstraintStatistics statistics;
+	};
+
+	DAG mDAG;
+	std::vector<ConstraintData> mConstraints;
+	/// The constraints that contain a variable.
+	std::map<Variable, std::vector<std::size_t>> mOccurrences;
+	double mEpsilon;
+
+	static Interval<Number> relation_interval(Relation rel) {
+		switch (rel) {
+			case Relation::LESS: return Interval<Number>(0, BoundType::INFTY, 0, BoundType::STRICT);
+			case Relation::LEQ: return Interval<Number>(0, BoundType::INFTY, 0, BoundType::WEAK);
+			case Relation::EQ: return Interval<Number>(0, BoundType::WEAK, 0, BoundType::WEAK);
+			case Relation::GEQ: return Interval<Number>(0, BoundType::WEAK, 0, BoundType::INFTY);
+			case Relation::GREATER: return Interval<Number>(0, BoundType::STRICT, 0, BoundType::INFTY);
+			default:
+				// Disequalities do not allow for contraction.
+				return Interval<Number>::unboundedInterval();
+		}
+	}
+
+	/// Checks whether the change of a single bound is significant, width is the width of the interval before or nullptr if it was unbounded.
+	bool significant_bound(BoundType before_type, const Number& before, BoundType after_type, const Number& after, const Number* width) const {
+		if (before_type == BoundType::INFTY) return after_type != BoundType::INFTY;
+		if (before == after) return false;
+		Number scale = width ? *width : std::max(Number(1), std::max(carl::abs(before), carl::abs(after)));
+		return carl::abs(after - before) > Number(mEpsilon) * scale;
+	}
+
+	bool significant(const Interval<Number>& before, const Interval<Number>& after) const {
+		Number width = before.isUnbounded() ? Number(0) : before.diameter();
+		const Number* w = before.isUnbounded() ? nullptr : &width;
+		return significant_bound(before.lowerBoundType(), before.lower(), after.lowerBoundType(), after.lower(), w)
+			|| significant_bound(before.upperBoundType(), before.upper(), after.upperBoundType(), after.upper(), w);
+	}
+
+	/**
+	 * Revises a single constraint.
+	 * @param data Constraint.
+	 * @param box Box, is contracted.
+	 * @param values Values of the nodes of the graph.
+	 * @param changed Is set to the variables whose intervals changed significantly.
+	 * @return False if the box is infeasible.
+	 */
+	bool revise(ConstraintData& data, IntervalBox<Number>& box, std::vector<Interval<Number>>& values, std::vector<Variable>& changed) const {
+		++data.statistics.revisions;
+		if (!data.root) {
+			if (data.target.contains(carl::constant_zero<Number>().get())) return true;
+			++data.statistics.conflicts;
+			return false;
+		}
+		mDAG.forward(data.nodes, box, values);
+		Interval<Number>& value = values[*data.root];
+		value = set_intersection(value, data.target);
+		if (value.isEmpty()) {
+			CARL_LOG_DEBUG("carl.contractor", data.constraint << " is infeasible on " << box);
+			++data.statistics.conflicts;
+			return false;
+		}
+		std::vector<Interval<Number>> before;
+		for (Variable v: data.variables) {
+			before.emplace_back(box.at(v));
+		}
+		if (!mDAG.backward(data.nodes, values, box)) {
+			CARL_LOG_DEBUG("carl.contractor", data.constraint << " is infeasible on " << box);
+			++data.statistics.conflicts;
+			return false;
+		}
+		bool contracted = false;
+		for (std::size_t i = 0; i < data.variables.size(); ++i) {
+			if (significant(before[i], box.at(data.variables[i]))) {
+				changed.push_back(data.variables[i]);
+				contracted = true;
+			}
+		}
+		if (contracted) {
+			CARL_LOG_DEBUG("carl.contractor", data.constraint << " contracted the box to " << box);
+			++data.statistics.contractions;
+		}
+		return true;
+	}
+
+public:
+	/**
+	 * Constructs the propagation engine for a set of constraints.
+	 * @param constraints Constraints.
+	 * @param epsilon Relative change of an interval below which other constraints are not revised again.
+	 */
+	explicit HC4(const Constraints<Polynomial>& constraints, double epsilon = 0.01):
+		mEpsilon(epsilon)
+	{
+		for (const auto& c: constraints) {
+			add(c);
+		}
+	}
+
+	/**
+	 * Adds a constraint.
+	 * @return The index of the constraint.
+	 */
+	std::size_t add(const Constraint<Polynomial>& c) {
+		ConstraintData data{c, std::nullopt, relation_interval(c.relation()), {}, {}, {}};
+		typename DAG::Coeff constant;
+		data.root = mDAG.add(c.lhs(), constant);
+		data.target -= Interval<Number>(constant);
+		if (data.root) {
+			data.nodes = mDAG.reachable(*data.root);
+			for (std::size_t id: data.nodes) {
+				if (mDAG[id].type == DAG::NodeType::VARIABLE) {
+					data.variables.push_back(mDAG[id].variable);
+					mOccurrences[mDAG[id].variable].push_back(mConstraints.size());
+				}
+			}
+		}
+		mConstraints.emplace_back(std::move(data));
+		return mConstraints.size() - 1;
+	}
+
+	std::size_t size() const {
+		return mConstraints.size();
+	}
+	const Constraint<Polynomial>& constraint(std::size_t id) const {
+		return mConstraints[id].constraint;
+	}
+	/// Returns the statistics of the given constraint, accumulated over all calls to contract().
+	const ConstraintStatistics& statistics(std::size_t id) const {
+		return mConstraints[id].statistics;
+	}
+	const DAG& dag() const {
+		return mDAG;
+	}
+
+	/**
+	 * Contracts the box with respect to all constraints until a fixpoint is reached.
+	 * Variables that are not assigned in the box are considered unbounded and are added to the box.
+	 * @param box Box.
+	 * @return False if the box contains no solution of the constraints. In this case, the box is left in an unspecified state.
+	 */
+	bool contract(IntervalBox<Number>& box) {
+		for (const auto& occ: mOccurrences) {
+			if (box.count(occ.first) == 0) box.insert_or_assign(occ.first, Interval<Number>::unboundedInterval());
+		}
+		std::vector<Interval<Number>> values(mDAG.size());
+		std::deque<std::size_t> queue;
+		std::vector<bool> queued(mConstraints.size(), true);
+		for (std::size_t i = 0; i < mConstraints.size(); ++i) {
+			queue.push_back(i);
+		}
+		std::vector<Variable> changed;
+		while (!queue.empty()) {
+			std::size_t cur = queue.front();
+			queue.pop_front();
+			queued[cur] = false;
+			changed.clear();
+			if (!revise(mConstraints[cur], box, values, changed)) return false;
+			for (Variable v: changed) {
+				for (std::size_t c: mOccurrences[v]) {
+					if (c != cur && !queued[c]) {
+						queued[c] = true;
+						queue.push_back(c);
+					}
+				}
+			}
+		}
+		return true;
+	}
+
+	/// Contracts the given map, see above.
+	bool contract(std::map<Variable, Interval<Number>>& map) {
+		IntervalBox<Number> box(map);
+		bool res = contract(box);
+		map = box.to_map();
+		return res;
+	}
+};
+
+}
+}
@@ -83,7 +83,7 @@ namespace carl
     template<typename Interval>
     struct policies<double, Interval>
     {
-        using roundingP = boost::numeric::interval_lib::save_state<boost::numeric::interval_lib::rounded_transc_std<double> >; // TODO: change it to boost::numeric::interval_lib::rounded_transc_opp, if new boost release patches the bug with clang
+        using roundingP = carl::rounding<double>;
         using checkingP = boost::numeric::interval_lib::checking_no_nan<double, boost::numeric::interval_lib::checking_no_nan<double> >;
 		static void sanitize(Interval& n) {
 			if (std::isinf(n.lower())) {
@@ -0,0 +1,162 @@
+/**
+ * @file IntervalBox.h
+ */
+
+#pragma once
+
+#include "Interval.h"
+#include "../core/Variable.h"
+
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace carl {
+
+/**
+ * An assignment of intervals to variables, i.e. a box, stored densely and indexed by the variables.
+ *
+ * Compared to std::map<Variable, Interval<Number>>, looking up the interval of a variable is a plain array access.
+ * The intervals are shared between copies of a box and only copied if one of the copies is modified (copy-on-write),
+ * hence copying a box to keep a snapshot, e.g. before splitting it in a branch-and-prune search, is cheap.
+ * The interface resembles the one of std::map (at(), count(), insert_or_assign()),
+ * such that code can be written for both kinds of assignments.
+ * Like other copy-on-write types, different copies of a box must not be modified concurrently.
+ */
+template<typename Number>
+class IntervalBox {
+public:
+	using key_type = Variable;
+	using mapped_type = Interval<Number>;
+
+private:
+	struct Storage {
+		std::vector<Interval<Number>> intervals;
+		/// The variable of every slot, Variable::NO_VARIABLE if it is not assigned.
+		std::vector<Variable> variables;
+		std::size_t size = 0;
+	};
+	std::shared_ptr<Storage> mStorage;
+
+	static constexpr std::size_t type_count = static_cast<std::size_t>(VariableType::TYPE_SIZE);
+
+	/// Variable ids are assigned per type, hence the slot combines the id with the type.
+	static std::size_t slot(Variable v) {
+		return v.id() * type_count + static_cast<std::size_t>(v.type());
+	}
+
+	/// Returns the storage for modifications, creates a private copy if it is shared.
+	Storage& mutable_storage() {
+		if (!mStorage) {
+			mStorage = std::make_shared<Storage>();
+		} else if (mStorage.use_count() > 1) {
+			mStorage = std::make_shared<Storage>(*mStorage);
+		}
+		return *mStorage;
+	}
+
+public:
+	IntervalBox() = default;
+
+	explicit IntervalBox(const std::map<Variable, Interval<Number>>& map) {
+		for (const auto& [var, interval]: map) {
+			insert_or_assign(var, interval);
+		}
+	}
+
+	/// Returns the number of variables that are assigned.
+	std::size_t size() const {
+		return mStorage ? mStorage->size : 0;
+	}
+	bool empty() const {
+		return size() == 0;
+	}
+
+	/// Returns 1 if v is assigned and 0 otherwise.
+	std::size_t count(Variable v) const {
+		if (!mStorage) return 0;
+		std::size_t s = slot(v);
+		return (s < mStorage->variables.size() && mStorage->variables[s] == v) ? 1 : 0;
+	}
+
+	/// Returns the interval of v, which must be assigned.
+	const Interval<Number>& operator[](Variable v) const {
+		assert(count(v) > 0);
+		return mStorage->intervals[slot(v)];
+	}
+
+	/// Returns the interval of v, throws std::out_of_range if v is not assigned.
+	const Interval<Number>& at(Variable v) const {
+		if (count(v) == 0) throw std::out_of_range("IntervalBox::at");
+		return mStorage->intervals[slot(v)];
+	}
+
+	/// Assigns the interval to v.
+	void insert_or_assign(Variable v, const Interval<Number>& interval) {
+		Storage& s = mutable_storage();
+		std::size_t i = slot(v);
+		if (i >= s.intervals.size()) {
+			s.intervals.resize(i + 1);
+			s.variables.resize(i + 1, Variable::NO_VARIABLE);
+		}
+		if (s.variables[i] == Variable::NO_VARIABLE) {
+			++s.size;
+		}
+		// Variables only differing in their rank share a slot, we assume that they are not used together.
+		assert(s.variables[i] == Variable::NO_VARIABLE || s.variables[i] == v);
+		s.variables[i] = v;
+		s.intervals[i] = interval;
+	}
+
+	/// Removes the assignment of v.
+	std::size_t erase(Variable v) {
+		if (count(v) == 0) return 0;
+		Storage& s = mutable_storage();
+		s.variables[slot(v)] = Variable::NO_VARIABLE;
+		--s.size;
+		return 1;
+	}
+
+	/// Calls f(variable, interval) for all assigned variables, ordered by their ids.
+	template<typename F>
+	void for_each(F&& f) const {
+		if (!mStorage) return;
+		for (std::size_t i = 0; i < mStorage->intervals.size(); ++i) {
+			if (mStorage->variables[i] != Variable::NO_VARIABLE) f(mStorage->variables[i], mStorage->intervals[i]);
+		}
+	}
+
+	/// Converts to a map, e.g. for functions that do not support boxes.
+	std::map<Variable, Interval<Number>> to_map() const {
+		std::map<Variable, Interval<Number>> res;
+		for_each([&res](Variable v, const Interval<Number>& i){ res.emplace(v, i); });
+		return res;
+	}
+
+	/// Checks whether both boxes assign the same intervals to the same variables.
+	bool operator==(const IntervalBox& rhs) const {
+		if (mStorage == rhs.mStorage) return true;
+		if (size() != rhs.size()) return false;
+		bool res = true;
+		for_each([&](Variable v, const Interval<Number>& i){ res = res && rhs.count(v) > 0 && rhs[v] == i; });
+		return res;
+	}
+	bool operator!=(const IntervalBox& rhs) const {
+		return !(*this == rhs);
+	}
+};
+
+template<typename Number>
+std::ostream& operator<<(std::ostream& os, const IntervalBox<Number>& box) {
+	os << "{";
+	bool first = true;
+	box.for_each([&](Variable v, const Interval<Number>& i){
+		if (!first) os << ", ";
+		first = false;
+		os << v << " : " << i;
+	});
+	return os << "}";
+}
+
+}
@@ -7,12 +7,15 @@
 
 #pragma once
 #include "Interval.h"
+#include "IntervalBox.h"
 #include "power.h"
 
 #include "../core/Monomial.h"
 #include "../core/Term.h"
 #include "../core/MultivariatePolynomial.h"
 
+#include <vector>
+
 
 
 namespace carl
@@ -21,38 +24,96 @@ namespace carl
 template<typename PolynomialType, class strategy  >
 class MultivariateHorner; 
 
+/**
+ * Evaluation of polynomials on intervals.
+ * The intervals of the variables are given either as a std::map or as an IntervalBox.
+ * Both kinds of assignments share the implementation, which only uses at() and count() on the assignment.
+ */
 class IntervalEvaluation
 {
 public:
 	template<typename Numeric>
-	static Interval<Numeric> evaluate(const Monomial& m, const std::map<Variable, Interval<Numeric>>&);
+	static Interval<Numeric> evaluate(const Monomial& m, const std::map<Variable, Interval<Numeric>>& map) {
+		return evaluate_monomial<Numeric>(m, map);
+	}
+	template<typename Numeric>
+	static Interval<Numeric> evaluate(const Monomial& m, const IntervalBox<Numeric>& box) {
+		return evaluate_monomial<Numeric>(m, box);
+	}
 
-	template<typename Coeff, typename Numeric, EnableIf<std::is_same<Numeric, Coeff>> = dummy>
-	static Interval<Numeric> evaluate(const Term<Coeff>& t, const std::map<Variable, Interval<Numeric>>&);
-	
-	template<typename Coeff, typename Numeric, DisableIf<std::is_same<Numeric, Coeff>> = dummy>
-	static Interval<Numeric> evaluate(const Term<Coeff>& t, const std::map<Variable, Interval<Numeric>>&);
+	template<typename Coeff, typename Numeric>
+	static Interval<Numeric> evaluate(const Term<Coeff>& t, const std::map<Variable, Interval<Numeric>>& map) {
+		return evaluate_term<Numeric>(t, map);
+	}
+	template<typename Coeff, typename Numeric>
+	static Interval<Numeric> evaluate(const Term<Coeff>& t, const IntervalBox<Numeric>& box) {
+		return evaluate_term<Numeric>(t, box);
+	}
 
 	template<typename Coeff, typename Policy, typename Ordering, typename Numeric>
-	static Interval<Numeric> evaluate(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const std::map<Variable, Interval<Numeric>>&);
-    
-
-	template<typename Numeric, typename Coeff, EnableIf<std::is_same<Numeric, Coeff>> = dummy>
-	static Interval<Numeric> evaluate(const UnivariatePolynomial<Coeff>& p, const std::map<Variable, Interval<Numeric>>& map);
-	
-	template<typename Numeric, typename Coeff, DisableIf<std::is_same<Numeric, Coeff>> = dummy>
-	static Interval<Numeric> evaluate(const UnivariatePolynomial<Coeff>& p, const std::map<Variable, Interval<Numeric>>& map);
-	
+	static Interval<Numeric> evaluate(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const std::map<Variable, Interval<Numeric>>& map) {
+		return evaluate_polynomial<Numeric>(p, map);
+	}
+	template<typename Coeff, typename Policy, typename Ordering, typename Numeric>
+	static Interval<Numeric> evaluate(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const IntervalBox<Numeric>& box) {
+		return evaluate_polynomial<Numeric>(p, box);
+	}
+
+	template<typename Numeric, typename Coeff>
+	static Interval<Numeric> evaluate(const UnivariatePolynomial<Coeff>& p, const std::map<Variable, Interval<Numeric>>& map) {
+		return evaluate_univariate<Numeric>(p, map);
+	}
+	template<typename Numeric, typename Coeff>
+	static Interval<Numeric> evaluate(const UnivariatePolynomial<Coeff>& p, const IntervalBox<Numeric>& box) {
+		return evaluate_univariate<Numeric>(p, box);
+	}
+
+	template<typename PolynomialType, typename Number, class strategy>
+	static Interval<Number> evaluate(const MultivariateHorner<PolynomialType, strategy>& mvH, const std::map<Variable, Interval<Number>>& map) {
+		return evaluate_horner<Number>(mvH, map);
+	}
 	template<typename PolynomialType, typename Number, class strategy>
-	static Interval<Number> evaluate(const MultivariateHorner<PolynomialType, strategy>& mvH, const std::map<Variable, Interval<Number>>& map);
-    
+	static Interval<Number> evaluate(const MultivariateHorner<PolynomialType, strategy>& mvH, const IntervalBox<Number>& box) {
+		return evaluate_horner<Number>(mvH, box);
+	}
+
 private:
+	template<typename Numeric, typename Assignment>
+	static Interval<Numeric> evaluate_monomial(const Monomial& m, const Assignment& map);
+
+	template<typename Numeric, typename Coeff, typename Assignment>
+	static Interval<Numeric> evaluate_term(const Term<Coeff>& t, const Assignment& map);
+
+	/// A power of a variable, stored in a flat array to share it between the terms of a polynomial.
+	template<typename Numeric>
+	struct Power {
+		Variable variable;
+		exponent exp;
+		Interval<Numeric> value;
+	};
+
+	template<typename Numeric, typename Assignment>
+	static const Interval<Numeric>& evaluate_power(Variable v, exponent exp, const Assignment& map, std::vector<Power<Numeric>>& powers);
+
+	template<typename Numeric, typename Coeff, typename Assignment>
+	static Interval<Numeric> evaluate_term(const Term<Coeff>& t, const Assignment& map, std::vector<Power<Numeric>>& powers);
+
+	template<typename Numeric, typename Coeff, typename Policy, typename Ordering, typename Assignment>
+	static Interval<Numeric> evaluate_polynomial(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const Assignment& map);
+
+	template<typename Numeric, typename Coeff, typename Assignment, EnableIf<std::is_same<Numeric, Coeff>> = dummy>
+	static Interval<Numeric> evaluate_univariate(const UnivariatePolynomial<Coeff>& p, const Assignment& map);
 
+	template<typename Numeric, typename Coeff, typename Assignment, DisableIf<std::is_same<Numeric, Coeff>> = dummy>
+	static Interval<Numeric> evaluate_univariate(const UnivariatePolynomial<Coeff>& p, const Assignment& map);
+
+	template<typename Number, typename PolynomialType, class strategy, typename Assignment>
+	static Interval<Number> evaluate_horner(const MultivariateHorner<PolynomialType, strategy>& mvH, const Assignment& map);
 };
 
 
-template<typename Numeric>
-inline Interval<Numeric> IntervalEvaluation::evaluate(const Monomial& m, const std::map<Variable, Interval<Numeric>>& map)
+template<typename Numeric, typename Assignment>
+inline Interval<Numeric> IntervalEvaluation::evaluate_monomial(const Monomial& m, const Assignment& map)
 {
 	Interval<Numeric> result(1);
 	// TODO use iterator.
@@ -69,43 +130,62 @@ inline Interval<Numeric> IntervalEvaluation::evaluate(const Monomial& m, const s
 	return result;
 }
 
-template<typename Coeff, typename Numeric, EnableIf<std::is_same<Numeric, Coeff>>>
-inline Interval<Numeric> IntervalEvaluation::evaluate(const Term<Coeff>& t, const std::map<Variable, Interval<Numeric>>& map)
+template<typename Numeric, typename Coeff, typename Assignment>
+inline Interval<Numeric> IntervalEvaluation::evaluate_term(const Term<Coeff>& t, const Assignment& map)
 {
 	Interval<Numeric> result(t.coeff());
 	if (t.monomial())
-		result *= IntervalEvaluation::evaluate( *t.monomial(), map );
+		result *= IntervalEvaluation::evaluate_monomial<Numeric>( *t.monomial(), map );
 	return result;
 }
 
-template<typename Coeff, typename Numeric, DisableIf<std::is_same<Numeric, Coeff>>>
-inline Interval<Numeric> IntervalEvaluation::evaluate(const Term<Coeff>& t, const std::map<Variable, Interval<Numeric>>& map)
+template<typename Numeric, typename Assignment>
+inline const Interval<Numeric>& IntervalEvaluation::evaluate_power(Variable v, exponent exp, const Assignment& map, std::vector<Power<Numeric>>& powers)
+{
+	for (const auto& power: powers) {
+		if (power.variable == v && power.exp == exp) return power.value;
+	}
+	// We expect every variable to be in the map.
+	CARL_LOG_ASSERT("carl.interval", map.count(v) > (size_t)0, "Every variable is expected to be in the map.");
+	powers.push_back(Power<Numeric>{v, exp, carl::pow(map.at(v), exp)});
+	return powers.back().value;
+}
+
+template<typename Numeric, typename Coeff, typename Assignment>
+inline Interval<Numeric> IntervalEvaluation::evaluate_term(const Term<Coeff>& t, const Assignment& map, std::vector<Power<Numeric>>& powers)
 {
 	Interval<Numeric> result(t.coeff());
-	if (t.monomial())
-		result *= IntervalEvaluation::evaluate( *t.monomial(), map );
+	if (t.monomial()) {
+		for (const auto& [var, exp]: *t.monomial()) {
+			result *= evaluate_power(var, exp, map, powers);
+			if (result.isZero())
+				return result;
+		}
+	}
 	return result;
 }
 
-template<typename Coeff, typename Policy, typename Ordering, typename Numeric>
-inline Interval<Numeric> IntervalEvaluation::evaluate(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const std::map<Variable, Interval<Numeric>>& map)
+template<typename Numeric, typename Coeff, typename Policy, typename Ordering, typename Assignment>
+inline Interval<Numeric> IntervalEvaluation::evaluate_polynomial(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const Assignment& map)
 {
 	CARL_LOG_FUNC("carl.core.monomial", p << ", " << map);
 	if(isZero(p)) {
 		return Interval<Numeric>(0);
 	} else {
-		Interval<Numeric> result(evaluate(p[0], map)); 
+		// Powers occurring in several terms are only computed once.
+		std::vector<Power<Numeric>> powers;
+		Interval<Numeric> result(evaluate_term<Numeric>(p[0], map, powers));
 		for (unsigned i = 1; i < p.nrTerms(); ++i) {
             if( result.isInfinite() )
                 return result;
-			result += evaluate(p[i], map);
+			result += evaluate_term<Numeric>(p[i], map, powers);
 		}
 		return result;
 	}
 }
 
-template<typename Numeric, typename Coeff, EnableIf<std::is_same<Numeric, Coeff>>>
-inline Interval<Numeric> IntervalEvaluation::evaluate(const UnivariatePolynomial<Coeff>& p, const std::map<Variable, Interval<Numeric>>& map) {
+template<typename Numeric, typename Coeff, typename Assignment, EnableIf<std::is_same<Numeric, Coeff>>>
+inline Interval<Numeric> IntervalEvaluation::evaluate_univariate(const UnivariatePolynomial<Coeff>& p, const Assignment& map) {
 	CARL_LOG_FUNC("carl.core.monomial", p << ", " << map);
 	assert(map.count(p.mainVar()) > 0);
 	Interval<Numeric> res = Interval<Numeric>::emptyInterval();
@@ -120,8 +200,8 @@ inline Interval<Numeric> IntervalEvaluation::evaluate(const UnivariatePolynomial
 	return res;
 }
 
-template<typename Numeric, typename Coeff, DisableIf<std::is_same<Numeric, Coeff>>>
-inline Interval<Numeric> IntervalEvaluation::evaluate(const UnivariatePolynomial<Coeff>& p, const std::map<Variable, Interval<Numeric>>& map) {
+template<typename Numeric, typename Coeff, typename Assignment, DisableIf<std::is_same<Numeric, Coeff>>>
+inline Interval<Numeric> IntervalEvaluation::evaluate_univariate(const UnivariatePolynomial<Coeff>& p, const Assignment& map) {
 	CARL_LOG_FUNC("carl.core.monomial", p << ", " << map);
 	assert(map.count(p.mainVar()) > 0);
 	Interval<Numeric> res = Interval<Numeric>(carl::constant_zero<Numeric>().get());
@@ -137,8 +217,8 @@ inline Interval<Numeric> IntervalEvaluation::evaluate(const UnivariatePolynomial
 }
 
 
-template<typename PolynomialType, typename Number, class strategy>
-inline Interval<Number> IntervalEvaluation::evaluate(const MultivariateHorner<PolynomialType, strategy>& mvH, const std::map<Variable, Interval<Number>>& map)
+template<typename Number, typename PolynomialType, class strategy, typename Assignment>
+inline Interval<Number> IntervalEvaluation::evaluate_horner(const MultivariateHorner<PolynomialType, strategy>& mvH, const Assignment& map)
 {
 	#ifdef DEBUG_HORNER
 		std::cout << __func__ << "   " << mvH << std::endl;
@@ -150,7 +230,7 @@ inline Interval<Number> IntervalEvaluation::evaluate(const MultivariateHorner<Po
 	if (mvH.getVariable() != Variable::NO_VARIABLE){
 		assert(map.count(mvH.getVariable()) > 0);
 		Interval<Number> res = Interval<Number>::emptyInterval();
-		const Interval<Number> varValue = map.find(mvH.getVariable())->second;
+		const Interval<Number> varValue = map.at(mvH.getVariable());
 
 		
 
@@ -163,19 +243,19 @@ inline Interval<Number> IntervalEvaluation::evaluate(const MultivariateHorner<Po
 		//Case 2: dependent part contains a Horner Scheme
 		else if (mvH.getDependent() && !mvH.getIndependent())
 		{
-			result = pow(varValue, mvH.getExponent()) * evaluate(*mvH.getDependent(), map) + Interval<Number> (mvH.getIndepConstant());
+			result = pow(varValue, mvH.getExponent()) * evaluate_horner<Number>(*mvH.getDependent(), map) + Interval<Number> (mvH.getIndepConstant());
 			return result;
 		}
 		//Case 3: independent part contains a Horner Scheme
 		else if (!mvH.getDependent() && mvH.getIndependent())
 		{
-			result = pow(varValue, mvH.getExponent()) * Interval<Number> (mvH.getDepConstant()) +  evaluate(*mvH.getIndependent(), map);
+			result = pow(varValue, mvH.getExponent()) * Interval<Number> (mvH.getDepConstant()) +  evaluate_horner<Number>(*mvH.getIndependent(), map);
 			return result;
 		}
 		//Case 4: both independent part and dependent part 
 		else if (mvH.getDependent()  && mvH.getIndependent())
 		{
-			result = pow(varValue, mvH.getExponent()) * evaluate(*mvH.getDependent(), map) + evaluate(*mvH.getIndependent(), map);
+			result = pow(varValue, mvH.getExponent()) * evaluate_horner<Number>(*mvH.getDependent(), map) + evaluate_horner<Number>(*mvH.getIndependent(), map);
 			return result;
 		}
 	}
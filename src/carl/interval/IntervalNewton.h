@@ -0,0 +1,233 @@
+#pragma once
+
+#include "../core/MultivariatePolynomial.h"
+#include "../core/polynomialfunctions/Derivative.h"
+#include "../core/polynomialfunctions/EigenWrapper.h"
+#include "Interval.h"
+#include "IntervalBox.h"
+#include "IntervalEvaluation.h"
+#include "sampling.h"
+#include "set_theory.h"
+
+#include <vector>
+
+namespace carl {
+namespace contractor {
+
+/**
+ * Multivariate interval Newton contractor for square systems of polynomial equations p_1 = ... = p_n = 0 in the variables x_1, ..., x_n.
+ *
+ * Every step evaluates the interval Jacobian J on the box X and the system at the midpoint m of X,
+ * and preconditions the linearization f(m) + J (x - m) = 0 with an approximate inverse Y of the midpoint of J,
+ * computed in floating point arithmetic by Eigen.
+ * Only the evaluations involving the box are done in interval arithmetic, hence Y does not need to be exact.
+ * The box is then contracted by one of the following operators:
+ * - Hansen-Sengupta: one Gauss-Seidel sweep on the preconditioned system Y J (x - m) = -Y f(m).
+ * - Krawczyk: X is intersected with K(X) = m - Y f(m) + (I - Y J) (X - m).
+ * Steps are repeated as long as some interval shrinks by more than a relative epsilon.
+ * If the operator maps X into its interior, the box contains a unique solution (see unique_solution()).
+ */
+template<typename Polynomial>
+class IntervalNewton {
+public:
+	enum class Method { HANSEN_SENGUPTA, KRAWCZYK };
+
+private:
+	using Number = double;
+	using I = Interval<Number>;
+
+	std::vector<Polynomial> mEquations;
+	std::vector<Variable> mVariables;
+	/// The Jacobian, stored row by row.
+	std::vector<Polynomial> mJacobian;
+	Method mMethod;
+	double mEpsilon;
+	std::size_t mMaxIterations;
+	bool mUniqueSolution = false;
+
+	std::size_t dim() const {
+		return mVariables.size();
+	}
+
+	/// Checks whether a is contained in the interior of b.
+	static bool in_interior(const I& a, const I& b) {
+		if (a.isEmpty()) return false;
+		bool lower = b.lowerBoundType() == BoundType::INFTY || (a.lowerBoundType() != BoundType::INFTY && a.lower() > b.lower());
+		bool upper = b.upperBoundType() == BoundType::INFTY || (a.upperBoundType() != BoundType::INFTY && a.upper() < b.upper());
+		return lower && upper;
+	}
+
+	/// Computes the smallest interval containing both intervals.
+	static I hull(const I& a, const I& b) {
+		if (a.isEmpty()) return b;
+		if (b.isEmpty()) return a;
+		I resA;
+		I resB;
+		if (set_union(a, b, resA, resB)) {
+			return I(resA.lowerBound(), resB.upperBound());
+		}
+		return resA;
+	}
+
+	/**
+	 * Performs a single step.
+	 * @return False if the box contains no solution.
+	 */
+	bool step(IntervalBox<Number>& box, bool& unique) const {
+		std::size_t n = dim();
+		std::vector<Number> mid(n);
+		IntervalBox<Number> point = box;
+		for (std::size_t i = 0; i < n; ++i) {
+			mid[i] = carl::center(box.at(mVariables[i]));
+			point.insert_or_assign(mVariables[i], I(mid[i]));
+		}
+		std::vector<I> fmid(n);
+		for (std::size_t i = 0; i < n; ++i) {
+			fmid[i] = IntervalEvaluation::evaluate(mEquations[i], point);
+		}
+		std::vector<I> jacobian(n * n);
+		std::vector<double> jacobian_mid(n * n);
+		for (std::size_t i = 0; i < n * n; ++i) {
+			jacobian[i] = IntervalEvaluation::evaluate(mJacobian[i], box);
+			if (jacobian[i].isUnbounded()) return true;
+			jacobian_mid[i] = carl::center(jacobian[i]);
+		}
+		std::vector<double> inverse = eigen::inverse(jacobian_mid, n);
+		if (inverse.empty()) {
+			CARL_LOG_DEBUG("carl.contractor", "Midpoint Jacobian is singular, skipping interval Newton step");
+			return true;
+		}
+
+		// Preconditioned system: a (x - m) = b with a = Y J and b = -Y f(m).
+		std::vector<I> a(n * n, I(0));
+		std::vector<I> b(n, I(0));
+		for (std::size_t i = 0; i < n; ++i) {
+			for (std::size_t k = 0; k < n; ++k) {
+				I y(inverse[i * n + k]);
+				b[i] -= y * fmid[k];
+				for (std::size_t j = 0; j < n; ++j) {
+					a[i * n + j] += y * jacobian[k * n + j];
+				}
+			}
+		}
+
+		std::vector<I> offset(n);
+		for (std::size_t i = 0; i < n; ++i) {
+			offset[i] = box.at(mVariables[i]) - I(mid[i]);
+		}
+		unique = true;
+		std::vector<I> result(n);
+		for (std::size_t i = 0; i < n; ++i) {
+			const I& cur = box.at(mVariables[i]);
+			I image;
+			if (mMethod == Method::KRAWCZYK) {
+				image = I(mid[i]) + b[i];
+				for (std::size_t j = 0; j < n; ++j) {
+					I diagonal = (i == j) ? I(1) - a[i * n + j] : -a[i * n + j];
+					image += diagonal * offset[j];
+				}
+			} else {
+				// Gauss-Seidel: uses the contracted offsets of the previous variables.
+				I rhs = b[i];
+				for (std::size_t j = 0; j < n; ++j) {
+					if (j != i) rhs -= a[i * n + j] * offset[j];
+				}
+				I resA;
+				I resB;
+				if (rhs.div_ext(a[i * n + i], resA, resB)) {
+					image = hull(set_intersection(offset[i], resA), set_intersection(offset[i], resB)) + I(mid[i]);
+					unique = false;
+				} else {
+					image = resA + I(mid[i]);
+				}
+			}
+			unique = unique && in_interior(image, cur);
+			result[i] = set_intersection(cur, image);
+			if (result[i].isEmpty()) {
+				CARL_LOG_DEBUG("carl.contractor", "Interval Newton step proved " << mVariables[i] << " to be infeasible");
+				return false;
+			}
+			if (mMethod == Method::HANSEN_SENGUPTA) {
+				offset[i] = result[i] - I(mid[i]);
+			}
+		}
+		for (std::size_t i = 0; i < n; ++i) {
+			box.insert_or_assign(mVariables[i], result[i]);
+		}
+		return true;
+	}
+
+public:
+	/**
+	 * Constructs the contractor for the system equations[i] = 0.
+	 * @param equations Polynomials.
+	 * @param variables Variables, as many as there are equations.
+	 * @param method Contraction operator.
+	 * @param epsilon Relative reduction of the width of some interval that is necessary to do another step.
+	 * @param max_iterations Maximal number of steps within contract().
+	 */
+	IntervalNewton(const std::vector<Polynomial>& equations, const std::vector<Variable>& variables, Method method = Method::HANSEN_SENGUPTA, double epsilon = 0.01, std::size_t max_iterations = 50):
+		mEquations(equations),
+		mVariables(variables),
+		mMethod(method),
+		mEpsilon(epsilon),
+		mMaxIterations(max_iterations)
+	{
+		assert(mEquations.size() == mVariables.size());
+		for (const auto& p: mEquations) {
+			for (Variable v: mVariables) {
+				mJacobian.emplace_back(carl::derivative(p, v));
+			}
+		}
+	}
+
+	const std::vector<Variable>& variables() const {
+		return mVariables;
+	}
+
+	/**
+	 * Whether the last call to contract() proved that the resulting box contains exactly one solution.
+	 */
+	bool unique_solution() const {
+		return mUniqueSolution;
+	}
+
+	/**
+	 * Contracts the box, which must assign bounded intervals to all variables.
+	 * @return False if the box contains no solution.
+	 */
+	bool contract(IntervalBox<Number>& box) {
+		mUniqueSolution = false;
+		for (Variable v: mVariables) {
+			assert(box.count(v) > 0);
+			if (box.at(v).isUnbounded()) return true;
+		}
+		for (std::size_t iteration = 0; iteration < mMaxIterations; ++iteration) {
+			std::vector<Number> widths;
+			for (Variable v: mVariables) {
+				widths.push_back(box.at(v).diameter());
+			}
+			bool unique = false;
+			if (!step(box, unique)) return false;
+			mUniqueSolution = mUniqueSolution || unique;
+			bool progress = false;
+			for (std::size_t i = 0; i < dim(); ++i) {
+				if (box.at(mVariables[i]).diameter() < (1 - mEpsilon) * widths[i]) progress = true;
+			}
+			CARL_LOG_DEBUG("carl.contractor", "Interval Newton step " << iteration << " resulted in " << box);
+			if (!progress) break;
+		}
+		return true;
+	}
+
+	/// Contracts the given map, see above.
+	bool contract(std::map<Variable, Interval<Number>>& map) {
+		IntervalBox<Number> box(map);
+		bool res = contract(box);
+		map = box.to_map();
+		return res;
+	}
+};
+
+}
+}
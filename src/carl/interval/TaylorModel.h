@@ -0,0 +1,194 @@
+#pragma once
+
+#include "../core/MultivariatePolynomial.h"
+#include "../core/polynomialfunctions/Substitution.h"
+#include "Interval.h"
+#include "IntervalBox.h"
+#include "IntervalEvaluation.h"
+#include "sampling.h"
+
+#include <map>
+#include <type_traits>
+
+namespace carl {
+
+/**
+ * Taylor model of a polynomial function on a box, i.e. a polynomial P of bounded total degree in the deviations h = x - c
+ * from an expansion point c and an interval remainder R, such that f(c + h) lies in P(h) + R for all h within the box.
+ *
+ * For a polynomial f, the Taylor expansion at c is obtained exactly by substituting x by c + h and all terms exceeding the order of the model
+ * are enclosed in the remainder. Both the expansion point and the coefficients are exact, only bounding P and the remainder uses interval arithmetic.
+ * As the expansion point is the center of the box, the deviations range over intervals that are symmetric around zero,
+ * the linear part is bounded exactly and the dependency problem only affects terms of higher degree in the small deviations,
+ * which usually yields much tighter enclosures than evaluating f directly.
+ * For example, x^2 - 2x on [0,2] becomes h^2 - 1 on [-1,1] for the expansion point 1 and evaluates to [-1,0].
+ *
+ * The deviation h_x is denoted by the variable x itself. Models of the same order can be combined arithmetically if they agree on the expansion point of common variables.
+ */
+template<typename Polynomial, typename Number = double>
+class TaylorModel {
+public:
+	using Coeff = typename Polynomial::CoeffType;
+
+private:
+	using I = Interval<Number>;
+
+	/// The expansion point.
+	std::map<Variable, Coeff> mExpansionPoint;
+	/// The intervals of the deviations from the expansion point.
+	IntervalBox<Number> mDomain;
+	/// The maximal total degree of the polynomial part.
+	std::size_t mOrder;
+	/// The polynomial part, in the deviations from the expansion point.
+	Polynomial mPolynomial;
+	/// The remainder.
+	I mRemainder;
+
+	TaylorModel(const std::map<Variable, Coeff>& expansion_point, const IntervalBox<Number>& domain, std::size_t order):
+		mExpansionPoint(expansion_point), mDomain(domain), mOrder(order), mRemainder(0)
+	{}
+
+	/// Moves all terms of p whose total degree exceeds the order to the remainder.
+	void truncate(const Polynomial& p) {
+		Polynomial low;
+		for (const auto& t: p) {
+			if (t.tdeg() > mOrder) {
+				mRemainder += IntervalEvaluation::evaluate(t, mDomain);
+			} else {
+				low += t;
+			}
+		}
+		mPolynomial = std::move(low);
+	}
+
+	/// Adds the expansion point and the domain of the variables of another model, which must agree on common variables.
+	void merge(const TaylorModel& rhs) {
+		assert(mOrder == rhs.mOrder);
+		for (const auto& [var, c]: rhs.mExpansionPoint) {
+			auto res = mExpansionPoint.emplace(var, c);
+			assert(res.second || res.first->second == c);
+			if (res.second) mDomain.insert_or_assign(var, rhs.mDomain.at(var));
+		}
+	}
+
+	static Coeff expansion_point(const I& i) {
+		if (i.isUnbounded()) return carl::constant_zero<Coeff>().get();
+		if constexpr (std::is_same<Number, Coeff>::value) {
+			return carl::center(i);
+		} else {
+			return carl::rationalize<Coeff>(carl::center(i));
+		}
+	}
+
+	template<typename Assignment>
+	void initialize(const Polynomial& p, const Assignment& map) {
+		std::map<Variable, Polynomial> shift;
+		for (Variable v: carl::variables(p)) {
+			CARL_LOG_ASSERT("carl.interval", map.count(v) > 0, "Every variable is expected to be in the map.");
+			const I& domain = map.at(v);
+			Coeff c = expansion_point(domain);
+			mExpansionPoint.emplace(v, c);
+			mDomain.insert_or_assign(v, domain - I(c));
+			if (!carl::isZero(c)) {
+				shift.emplace(v, Polynomial(v) + c);
+			}
+		}
+		truncate(carl::substitute(p, shift));
+	}
+
+public:
+	/**
+	 * Constructs the Taylor model of p on the given intervals, expanded at the centers of the intervals.
+	 * Unbounded intervals are expanded at zero.
+	 * @param p Polynomial.
+	 * @param map Intervals of all variables of p.
+	 * @param order Maximal total degree of the polynomial part.
+	 */
+	TaylorModel(const Polynomial& p, const std::map<Variable, I>& map, std::size_t order):
+		mOrder(order), mRemainder(0)
+	{
+		initialize(p, map);
+	}
+	/// Constructs the Taylor model of p on the given box, see above.
+	TaylorModel(const Polynomial& p, const IntervalBox<Number>& box, std::size_t order):
+		mOrder(order), mRemainder(0)
+	{
+		initialize(p, box);
+	}
+
+	const std::map<Variable, Coeff>& expansion_point() const {
+		return mExpansionPoint;
+	}
+	const IntervalBox<Number>& domain() const {
+		return mDomain;
+	}
+	std::size_t order() const {
+		return mOrder;
+	}
+	const Polynomial& polynomial() const {
+		return mPolynomial;
+	}
+	const I& remainder() const {
+		return mRemainder;
+	}
+
+	/// Encloses the range of the polynomial part.
+	I bound() const {
+		return IntervalEvaluation::evaluate(mPolynomial, mDomain);
+	}
+
+	/// Computes the interval enclosed by this model.
+	I to_interval() const {
+		return bound() + mRemainder;
+	}
+
+	TaylorModel operator-() const {
+		TaylorModel res(*this);
+		res.mPolynomial = -mPolynomial;
+		res.mRemainder = -mRemainder;
+		return res;
+	}
+
+	TaylorModel& operator+=(const TaylorModel& rhs) {
+		merge(rhs);
+		mPolynomial += rhs.mPolynomial;
+		mRemainder += rhs.mRemainder;
+		return *this;
+	}
+	TaylorModel& operator-=(const TaylorModel& rhs) {
+		return *this += -rhs;
+	}
+
+	TaylorModel operator*(const TaylorModel& rhs) const {
+		TaylorModel res(mExpansionPoint, mDomain, mOrder);
+		res.merge(rhs);
+		// (P + R) (Q + S) = P Q + P S + Q R + R S
+		res.mRemainder = bound() * rhs.mRemainder + rhs.bound() * mRemainder + mRemainder * rhs.mRemainder;
+		res.truncate(mPolynomial * rhs.mPolynomial);
+		return res;
+	}
+	TaylorModel operator*(const Coeff& rhs) const {
+		TaylorModel res(*this);
+		res.mPolynomial *= rhs;
+		res.mRemainder *= I(rhs);
+		return res;
+	}
+};
+
+template<typename Polynomial, typename Number>
+inline TaylorModel<Polynomial, Number> operator+(const TaylorModel<Polynomial, Number>& lhs, const TaylorModel<Polynomial, Number>& rhs) {
+	TaylorModel<Polynomial, Number> res(lhs);
+	return res += rhs;
+}
+template<typename Polynomial, typename Number>
+inline TaylorModel<Polynomial, Number> operator-(const TaylorModel<Polynomial, Number>& lhs, const TaylorModel<Polynomial, Number>& rhs) {
+	TaylorModel<Polynomial, Number> res(lhs);
+	return res -= rhs;
+}
+
+template<typename Polynomial, typename Number>
+inline std::ostream& operator<<(std::ostream& os, const TaylorModel<Polynomial, Number>& tm) {
+	return os << tm.polynomial() << " + " << tm.remainder() << " at " << tm.expansion_point();
+}
+
+}
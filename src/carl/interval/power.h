@@ -7,9 +7,72 @@
 
 namespace carl {
 
+namespace detail {
+	/// Computes x^exp for x >= 0 by repeated squaring, rounded down.
+	template<typename Number, typename Rounding>
+	Number pow_down(Number x, uint exp, Rounding& rnd) {
+		Number res = (exp % 2 == 1) ? x : carl::constant_one<Number>().get();
+		for (exp /= 2; exp > 0; exp /= 2) {
+			x = rnd.mul_down(x, x);
+			if (exp % 2 == 1) res = rnd.mul_down(x, res);
+		}
+		return res;
+	}
+	/// Computes x^exp for x >= 0 by repeated squaring, rounded up.
+	template<typename Number, typename Rounding>
+	Number pow_up(Number x, uint exp, Rounding& rnd) {
+		Number res = (exp % 2 == 1) ? x : carl::constant_one<Number>().get();
+		for (exp /= 2; exp > 0; exp /= 2) {
+			x = rnd.mul_up(x, x);
+			if (exp % 2 == 1) res = rnd.mul_up(x, res);
+		}
+		return res;
+	}
+
+	/**
+	 * Computes i^exp for a nonempty interval with finite bounds and exp > 0.
+	 * Odd powers are monotone and map the bounds directly.
+	 * Even powers only depend on the magnitude, hence the result is spanned by the smallest and the largest magnitude within i
+	 * and only a single power is computed for each bound.
+	 */
+	template<typename Number>
+	Interval<Number> pow_bounded(const Interval<Number>& i, uint exp) {
+		typename Interval<Number>::BoostIntervalPolicies::rounding rnd;
+		const Number& zero = carl::constant_zero<Number>().get();
+		const Number& l = i.lower();
+		const Number& u = i.upper();
+		if (exp % 2 == 1) {
+			Number lower = l < zero ? Number(-pow_up(Number(-l), exp, rnd)) : pow_down(l, exp, rnd);
+			Number upper = u < zero ? Number(-pow_down(Number(-u), exp, rnd)) : pow_up(u, exp, rnd);
+			return Interval<Number>(lower, i.lowerBoundType(), upper, i.upperBoundType());
+		}
+		Number lower = zero;
+		BoundType lowerType = BoundType::WEAK;
+		if (l >= zero) {
+			lower = pow_down(l, exp, rnd);
+			lowerType = i.lowerBoundType();
+		} else if (u <= zero) {
+			lower = pow_down(Number(-u), exp, rnd);
+			lowerType = i.upperBoundType();
+		}
+		Number magnitude = -l;
+		BoundType upperType = i.lowerBoundType();
+		if (u > magnitude) {
+			magnitude = u;
+			upperType = i.upperBoundType();
+		} else if (u == magnitude) {
+			upperType = getWeakestBoundType(i.lowerBoundType(), i.upperBoundType());
+		}
+		return Interval<Number>(lower, lowerType, pow_up(magnitude, exp, rnd), upperType);
+	}
+}
+
 template<typename Number, typename Integer>
 Interval<Number> pow(const Interval<Number>& i, Integer exp) {
 	assert(i.isConsistent());
+	if (exp > 0 && i.lowerBoundType() != BoundType::INFTY && i.upperBoundType() != BoundType::INFTY && !i.isEmpty()) {
+		return detail::pow_bounded(i, uint(exp));
+	}
 	if (exp % 2 == 0) {
 		if (i.isInfinite()) {
 			return Interval<Number>(carl::constant_zero<Number>().get(), BoundType::WEAK, carl::constant_zero<Number>().get(), BoundType::INFTY);
@@ -214,4 +214,5 @@ namespace carl
     };
 }
 
+#include "rounding/rounding_double.tpp"
 #include "rounding/rounding_float_t.tpp"
\ No newline at end of file
@@ -0,0 +1,268 @@
+/*
+ * This file contains the rounding policy needed from the boost interval class
+ * for native doubles.
+ *
+ * @file   rounding_double.tpp
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace carl
+{
+    /**
+     * Rounding policy for native doubles that never changes the rounding mode of the floating point unit.
+     *
+     * All operations are computed with the default rounding to nearest.
+     * For +, -, *, / and sqrt, the exact rounding error is obtained by an error-free transformation
+     * (TwoSum for additions, TwoProduct otherwise) and the result is moved by one ulp if it lies on the wrong side.
+     * TwoProduct uses a fused multiply-add if the target provides a fast one and Dekker's splitting otherwise.
+     * This yields the same bounds as directed rounding, in particular exact operations stay exact,
+     * but avoids switching the rounding mode before and after every single operation.
+     * If underflow may render the error term inexact, inexact results are moved by one ulp unconditionally.
+     * The transcendental functions of the standard library are not correctly rounded, hence their results are moved by two ulps.
+     */
+    template<>
+    struct rounding<double>
+    {
+        using unprotected_rounding = rounding<double>;
+    private:
+        static constexpr double infinity = std::numeric_limits<double>::infinity();
+        /// Below this magnitude, the error term of a product, quotient or square root may be affected by underflow.
+        static constexpr double underflow_threshold = 0x1p-900;
+        /// Above this magnitude, Dekker's splitting may overflow.
+        static constexpr double overflow_threshold = 0x1p995;
+        /// Number of ulps the results of transcendental functions are moved.
+        static constexpr int transcendental_ulps = 2;
+
+        /// Returns the next double towards -infinity, assumes that x is not nan or -infinity.
+        static double pred(double x) {
+            if (x == 0) return -std::numeric_limits<double>::denorm_min();
+            auto bits = bit_cast<std::uint64_t>(x);
+            return bit_cast<double>(x > 0 ? bits - 1 : bits + 1);
+        }
+        /// Returns the next double towards infinity, assumes that x is not nan or infinity.
+        static double succ(double x) {
+            if (x == 0) return std::numeric_limits<double>::denorm_min();
+            auto bits = bit_cast<std::uint64_t>(x);
+            return bit_cast<double>(x > 0 ? bits + 1 : bits - 1);
+        }
+        template<typename To, typename From>
+        static To bit_cast(From from) {
+            static_assert(sizeof(To) == sizeof(From), "bit_cast requires types of equal size");
+            To to;
+            std::memcpy(&to, &from, sizeof(To));
+            return to;
+        }
+        /// Rounds r down, where r + error is the exact result.
+        static double down(double r, double error) {
+            return error < 0 ? pred(r) : r;
+        }
+        /// Rounds r up, where r + error is the exact result.
+        static double up(double r, double error) {
+            return error > 0 ? succ(r) : r;
+        }
+        /// Replaces an overflow of finite operands by the largest finite double when rounding down.
+        static double overflow_down(double r, double x, double y) {
+            return (r == infinity && std::isfinite(x) && std::isfinite(y)) ? std::numeric_limits<double>::max() : r;
+        }
+        /// Replaces an overflow of finite operands by the smallest finite double when rounding up.
+        static double overflow_up(double r, double x, double y) {
+            return (r == -infinity && std::isfinite(x) && std::isfinite(y)) ? std::numeric_limits<double>::lowest() : r;
+        }
+        static double widen_down(double r) {
+            if (std::isnan(r) || r == -infinity) return r;
+            for (int i = 0; i < transcendental_ulps; ++i) r = pred(r);
+            return r;
+        }
+        static double widen_up(double r) {
+            if (std::isnan(r) || r == infinity) return r;
+            for (int i = 0; i < transcendental_ulps; ++i) r = succ(r);
+            return r;
+        }
+
+        /// Computes s = x + y and its exact error (TwoSum).
+        static double sum_error(double x, double y, double s) {
+            double yv = s - x;
+            return (x - (s - yv)) + (y - yv);
+        }
+        /// Computes a value with the sign of x - a * b, where a * b is close to x and does not underflow or overflow (TwoProduct).
+        static double remainder(double x, double a, double b) {
+#ifdef FP_FAST_FMA
+            return std::fma(-a, b, x);
+#else
+            // Dekker's splitting of a and b into halves of 26 bits, such that all partial products are exact.
+            constexpr double splitter = 134217729.0; // 2^27 + 1
+            double ta = splitter * a;
+            double ah = ta - (ta - a);
+            double al = a - ah;
+            double tb = splitter * b;
+            double bh = tb - (tb - b);
+            double bl = b - bh;
+            double p = a * b;
+            double error = ((ah * bh - p) + ah * bl + al * bh) + al * bl;
+            // x - p is exact as p is close to x, the final subtraction preserves the sign.
+            return (x - p) - error;
+#endif
+        }
+        /// Checks whether the error terms of operations on these operands are neither affected by underflow nor overflow.
+        static bool in_range(double a, double b, double result) {
+            return std::abs(result) >= underflow_threshold
+                && std::abs(a) >= std::numeric_limits<double>::min() && std::abs(a) <= overflow_threshold
+                && std::abs(b) >= std::numeric_limits<double>::min() && std::abs(b) <= overflow_threshold;
+        }
+        /// Computes a value with the sign of the error of p = x * y or nan if it is not available.
+        static double product_error(double x, double y, double p) {
+            if (x == 0 || y == 0) return 0;
+            if (!in_range(x, y, p)) return std::numeric_limits<double>::quiet_NaN();
+            return -remainder(p, x, y);
+        }
+        /// Computes a value with the sign of the error of q = x / y or nan if it is not available.
+        static double quotient_error(double x, double y, double q) {
+            if (x == 0 || std::isinf(y)) return 0;
+            if (!in_range(q, y, x)) return std::numeric_limits<double>::quiet_NaN();
+            double r = remainder(x, q, y);
+            return y > 0 ? r : -r;
+        }
+        /// Computes a value with the sign of the error of s = sqrt(x) or nan if it is not available.
+        static double sqrt_error(double x, double s) {
+            if (!in_range(s, s, x)) return std::numeric_limits<double>::quiet_NaN();
+            return remainder(x, s, s);
+        }
+        static double down_or_pred(double r, double error) {
+            return std::isnan(error) ? pred(r) : down(r, error);
+        }
+        static double up_or_succ(double r, double error) {
+            return std::isnan(error) ? succ(r) : up(r, error);
+        }
+    public:
+        // mathematical operations
+        double add_down(double _lhs, double _rhs) // [-∞;+∞][-∞;+∞]
+        {
+            double s = _lhs + _rhs;
+            if (!std::isfinite(s)) return overflow_down(s, _lhs, _rhs);
+            return down(s, sum_error(_lhs, _rhs, s));
+        }
+
+        double add_up(double _lhs, double _rhs) // [-∞;+∞][-∞;+∞]
+        {
+            double s = _lhs + _rhs;
+            if (!std::isfinite(s)) return overflow_up(s, _lhs, _rhs);
+            return up(s, sum_error(_lhs, _rhs, s));
+        }
+
+        double sub_down(double _lhs, double _rhs) // [-∞;+∞][-∞;+∞]
+        {
+            return add_down(_lhs, -_rhs);
+        }
+
+        double sub_up  (double _lhs, double _rhs) // [-∞;+∞][-∞;+∞]
+        {
+            return add_up(_lhs, -_rhs);
+        }
+
+        double mul_down(double _lhs, double _rhs) // [-∞;+∞][-∞;+∞]
+        {
+            double p = _lhs * _rhs;
+            if (!std::isfinite(p)) return overflow_down(p, _lhs, _rhs);
+            return down_or_pred(p, product_error(_lhs, _rhs, p));
+        }
+
+        double mul_up  (double _lhs, double _rhs) // [-∞;+∞][-∞;+∞]
+        {
+            double p = _lhs * _rhs;
+            if (!std::isfinite(p)) return overflow_up(p, _lhs, _rhs);
+            return up_or_succ(p, product_error(_lhs, _rhs, p));
+        }
+
+        double div_down(double _lhs, double _rhs) // [-∞;+∞]([-∞;+∞]-{0})
+        {
+            double q = _lhs / _rhs;
+            if (!std::isfinite(q)) return _rhs == 0 ? q : overflow_down(q, _lhs, _rhs);
+            return down_or_pred(q, quotient_error(_lhs, _rhs, q));
+        }
+
+        double div_up  (double _lhs, double _rhs) // [-∞;+∞]([-∞;+∞]-{0})
+        {
+            double q = _lhs / _rhs;
+            if (!std::isfinite(q)) return _rhs == 0 ? q : overflow_up(q, _lhs, _rhs);
+            return up_or_succ(q, quotient_error(_lhs, _rhs, q));
+        }
+
+        double sqrt_down(double _val)   // ]0;+∞]
+        {
+            if (_val <= 0) return 0;
+            double s = std::sqrt(_val);
+            if (std::isinf(s)) return s;
+            return down_or_pred(s, sqrt_error(_val, s));
+        }
+
+        double sqrt_up  (double _val)   // ]0;+∞]
+        {
+            if (_val <= 0) return 0;
+            double s = std::sqrt(_val);
+            if (std::isinf(s)) return s;
+            return up_or_succ(s, sqrt_error(_val, s));
+        }
+
+#define CARL_ROUNDING_DOUBLE_TRANSCENDENTAL(f) \
+        double f##_down(double _val) { return widen_down(std::f(_val)); } \
+        double f##_up  (double _val) { return widen_up(std::f(_val)); }
+
+        CARL_ROUNDING_DOUBLE_TRANSCENDENTAL(exp)
+        CARL_ROUNDING_DOUBLE_TRANSCENDENTAL(log)
+        CARL_ROUNDING_DOUBLE_TRANSCENDENTAL(sin)
+        CARL_ROUNDING_DOUBLE_TRANSCENDENTAL(cos)
+        CARL_ROUNDING_DOUBLE_TRANSCENDENTAL(tan)
+        CARL_ROUNDING_DOUBLE_TRANSCENDENTAL(asin)
+        CARL_ROUNDING_DOUBLE_TRANSCENDENTAL(acos)
+        CARL_ROUNDING_DOUBLE_TRANSCENDENTAL(atan)
+        CARL_ROUNDING_DOUBLE_TRANSCENDENTAL(sinh)
+        CARL_ROUNDING_DOUBLE_TRANSCENDENTAL(cosh)
+        CARL_ROUNDING_DOUBLE_TRANSCENDENTAL(tanh)
+        CARL_ROUNDING_DOUBLE_TRANSCENDENTAL(asinh)
+        CARL_ROUNDING_DOUBLE_TRANSCENDENTAL(acosh)
+        CARL_ROUNDING_DOUBLE_TRANSCENDENTAL(atanh)
+#undef CARL_ROUNDING_DOUBLE_TRANSCENDENTAL
+
+        double median(double _val1, double _val2)   // [-∞;+∞][-∞;+∞]
+        {
+            return (_val1 + _val2) / 2;
+        }
+        double int_down(double _val)    // [-∞;+∞]
+        {
+            return std::floor(_val);
+        }
+        double int_up  (double _val)    // [-∞;+∞]
+        {
+            return std::ceil(_val);
+        }
+        // conversion functions
+        template<typename U>
+        double conv_down(U _val)
+        {
+            if constexpr (std::is_same<U, double>::value) {
+                return _val;
+            } else {
+                double r = static_cast<double>(_val);
+                return static_cast<long double>(r) > static_cast<long double>(_val) ? pred(r) : r;
+            }
+        }
+
+        template<typename U>
+        double conv_up(U _val)
+        {
+            if constexpr (std::is_same<U, double>::value) {
+                return _val;
+            } else {
+                double r = static_cast<double>(_val);
+                return static_cast<long double>(r) < static_cast<long double>(_val) ? succ(r) : r;
+            }
+        }
+    };
+}
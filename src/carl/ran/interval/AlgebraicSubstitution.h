@@ -24,6 +24,12 @@
 #include <carl/core/polynomialfunctions/Resultant.h>
 #include <carl/core/polynomialfunctions/to_univariate_polynomial.h>
 
+#include <carl-statistics/carl-statistics.h>
+
+#include <algorithm>
+#include <chrono>
+#include <optional>
+
 namespace carl::ran::interval {
 
 /**
@@ -84,11 +90,14 @@ std::optional<UnivariatePolynomial<Number>> algebraic_substitution_groebner(
  * Eventually we obtain a polynomial univariate in the remaining variable, our result.
  * 
  * Note that we assume that the polynomials are in a triangular form where any polynomial may contain variables that are ``defined'' by the previous polynomials.
+ *
+ * If a deadline is given, the computation is cancelled (and std::nullopt is returned) if the deadline has passed before some resultant is computed.
  */
 template<typename Number>
 std::optional<UnivariatePolynomial<Number>> algebraic_substitution_resultant(
 	const UnivariatePolynomial<MultivariatePolynomial<Number>>& p,
-	const std::vector<UnivariatePolynomial<MultivariatePolynomial<Number>>>& polynomials
+	const std::vector<UnivariatePolynomial<MultivariatePolynomial<Number>>>& polynomials,
+	std::optional<std::chrono::steady_clock::time_point> deadline = std::nullopt
 ) {
 	Variable v = p.mainVar();
 	UnivariatePolynomial<MultivariatePolynomial<Number>> cur = p;
@@ -97,6 +106,10 @@ std::optional<UnivariatePolynomial<Number>> algebraic_substitution_resultant(
 		if (!cur.has(poly.mainVar())) {
 			continue;
 		}
+		if (deadline && std::chrono::steady_clock::now() >= *deadline) {
+			CARL_LOG_DEBUG("carl.algsubs", "Deadline has passed, cancelling");
+			return std::nullopt;
+		}
 		cur = pseudo_remainder(switch_main_variable(cur, poly.mainVar()), poly);
 		CARL_LOG_DEBUG("carl.algsubs", "Computing resultant of " << cur << " and " << poly);
 		cur = carl::resultant(cur, poly);
@@ -136,12 +149,155 @@ std::optional<UnivariatePolynomial<Number>> algebraic_substitution_resultant(
 
 /// Indicates which strategy to use: resultants or Gröbner bases.
 enum class AlgebraicSubstitutionStrategy {
-	RESULTANT, GROEBNER
+	RESULTANT, GROEBNER,
+	/// Select resultants or Gröbner bases from cheap features of the input, see select_strategy().
+	ADAPTIVE,
+	/// Run the resultant strategy for a limited time, and switch to Gröbner bases if it does not finish in time.
+	RACE
+};
+
+inline std::ostream& operator<<(std::ostream& os, AlgebraicSubstitutionStrategy strategy) {
+	switch (strategy) {
+		case AlgebraicSubstitutionStrategy::RESULTANT: return os << "resultant";
+		case AlgebraicSubstitutionStrategy::GROEBNER: return os << "groebner";
+		case AlgebraicSubstitutionStrategy::ADAPTIVE: return os << "adaptive";
+		case AlgebraicSubstitutionStrategy::RACE: return os << "race";
+	}
+	return os;
+}
+
+namespace algsubs {
+
+#ifdef CARL_DEVOPTION_Statistics
+
+class AlgebraicSubstitutionStatistics : public statistics::Statistics {
+public:
+	/// Time spent in the resultant strategy, including cancelled runs.
+	statistics::timer resultant;
+	/// Time spent in the Gröbner strategy.
+	statistics::timer groebner;
+	/// Number of resultant computations cancelled when racing.
+	std::size_t race_cancelled = 0;
+	void collect() {
+		Statistics::addKeyValuePair("resultant", resultant);
+		Statistics::addKeyValuePair("groebner", groebner);
+		Statistics::addKeyValuePair("race_cancelled", race_cancelled);
+	}
 };
 
+static auto& statistics() {
+	static CARL_INIT_STATISTICS(AlgebraicSubstitutionStatistics, stats, "algebraic_substitution");
+	return stats;
+}
+
+#endif
+
+/// Cheap features of an algebraic substitution problem that indicate which strategy is faster.
+struct Features {
+	/// Number of defining polynomials that are not linear in their main variable.
+	std::size_t algebraic_variables = 0;
+	/// Product of the degrees of the defining polynomials in their main variables (saturated), bounds the degree of the result.
+	std::size_t degree_product = 1;
+	/// Maximal degree of the input polynomial in the variables to eliminate.
+	std::size_t max_degree = 0;
+	/// Maximal bit size of a coefficient.
+	std::size_t max_coefficient_bits = 0;
+};
+
+inline std::ostream& operator<<(std::ostream& os, const Features& f) {
+	return os << "(" << f.algebraic_variables << " extensions, degree product " << f.degree_product << ", degree " << f.max_degree << ", " << f.max_coefficient_bits << " bits)";
+}
+
+/// Saturation bound for Features::degree_product.
+constexpr std::size_t degree_product_bound = 1 << 16;
+/// Upper bound on degree_product * max_degree (the degree of the result) up to which resultants are used with two extensions.
+constexpr std::size_t resultant_degree_threshold = 64;
+/// Upper bound on the coefficient size up to which resultants are used with two extensions.
+constexpr std::size_t resultant_bits_threshold = 64;
+
+/**
+ * Computes the features of substituting the defining polynomials into p.
+ */
+template<typename Number>
+Features features(
+	const UnivariatePolynomial<MultivariatePolynomial<Number>>& p,
+	const std::vector<UnivariatePolynomial<MultivariatePolynomial<Number>>>& polynomials
+) {
+	Features res;
+	auto update_bits = [&res](const UnivariatePolynomial<MultivariatePolynomial<Number>>& poly) {
+		for (const auto& c: poly.coefficients()) {
+			for (const auto& t: c) {
+				res.max_coefficient_bits = std::max(res.max_coefficient_bits, carl::bitsize(t.coeff()));
+			}
+		}
+	};
+	update_bits(p);
+	for (const auto& poly: polynomials) {
+		update_bits(poly);
+		if (poly.degree() > 1) {
+			++res.algebraic_variables;
+			res.degree_product = std::min(res.degree_product * poly.degree(), degree_product_bound);
+		}
+		for (const auto& c: p.coefficients()) {
+			res.max_degree = std::max(res.max_degree, c.degree(poly.mainVar()));
+		}
+	}
+	return res;
+}
+
+/**
+ * Selects a strategy from the features of an algebraic substitution problem.
+ * A single resultant is cheap, hence resultants are used for a single extension.
+ * Iterated resultants suffer from the growth of degrees and coefficients of the intermediate results,
+ * hence Gröbner bases are used for three or more extensions and for two extensions with large degrees or coefficients.
+ */
+inline AlgebraicSubstitutionStrategy select_strategy(const Features& f) {
+	if (f.algebraic_variables <= 1) return AlgebraicSubstitutionStrategy::RESULTANT;
+	if (f.algebraic_variables >= 3) return AlgebraicSubstitutionStrategy::GROEBNER;
+	if (f.degree_product * std::max(f.max_degree, std::size_t(1)) > resultant_degree_threshold) return AlgebraicSubstitutionStrategy::GROEBNER;
+	if (f.max_coefficient_bits > resultant_bits_threshold) return AlgebraicSubstitutionStrategy::GROEBNER;
+	return AlgebraicSubstitutionStrategy::RESULTANT;
+}
+
+/// Runs the resultant strategy and records its timing.
+template<typename Number>
+std::optional<UnivariatePolynomial<Number>> timed_resultant(
+	const UnivariatePolynomial<MultivariatePolynomial<Number>>& p,
+	const std::vector<UnivariatePolynomial<MultivariatePolynomial<Number>>>& polynomials,
+	std::optional<std::chrono::steady_clock::time_point> deadline = std::nullopt
+) {
+	auto start = CARL_TIME_START();
+	auto res = algebraic_substitution_resultant(p, polynomials, deadline);
+	CARL_TIME_FINISH(statistics().resultant, start);
+	return res;
+}
+
+/// Runs the Gröbner strategy and records its timing.
+template<typename Number>
+std::optional<UnivariatePolynomial<Number>> timed_groebner(
+	const UnivariatePolynomial<MultivariatePolynomial<Number>>& p,
+	const std::vector<UnivariatePolynomial<MultivariatePolynomial<Number>>>& polynomials
+) {
+	auto start = CARL_TIME_START();
+	auto res = algebraic_substitution_groebner(p, polynomials);
+	CARL_TIME_FINISH(statistics().groebner, start);
+	return res;
+}
+
+}
+
+/// Time limit for the resultant strategy when racing.
+constexpr std::chrono::milliseconds algebraic_substitution_race_budget(50);
+
 /**
  * Computes the algebraic substitution of the given defining polynomials into a multivariate polynomial p.
  * The result is a univariate polynomial in the main variable of p.
+ *
+ * Resultants are used by default. ADAPTIVE and RACE have to be requested explicitly,
+ * as the thresholds of select_strategy() are not backed by benchmarks yet.
+ * If the Gröbner strategy was selected automatically (by ADAPTIVE or RACE) but fails to produce a univariate polynomial,
+ * the resultant strategy is used instead.
+ * Note that the resultant computation is only cancelled between two resultants, i.e. RACE may exceed its time limit.
  */
 template<typename Number>
 std::optional<UnivariatePolynomial<Number>> algebraic_substitution(
@@ -149,13 +305,35 @@ std::optional<UnivariatePolynomial<Number>> algebraic_substitution(
 	const std::vector<UnivariatePolynomial<MultivariatePolynomial<Number>>>& polynomials,
 	AlgebraicSubstitutionStrategy strategy = AlgebraicSubstitutionStrategy::RESULTANT
 ) {
-	CARL_LOG_DEBUG("carl.algsubs", "Substituting " << polynomials << " into " << p);
+	CARL_LOG_DEBUG("carl.algsubs", "Substituting " << polynomials << " into " << p << " by " << strategy);
 	switch (strategy) {
 		case AlgebraicSubstitutionStrategy::GROEBNER:
-			return algebraic_substitution_groebner(p, polynomials);
+			return algsubs::timed_groebner(p, polynomials);
+		case AlgebraicSubstitutionStrategy::ADAPTIVE: {
+			auto features = algsubs::features(p, polynomials);
+			auto selected = algsubs::select_strategy(features);
+			CARL_LOG_DEBUG("carl.algsubs", "Selected " << selected << " for " << features);
+			if (selected == AlgebraicSubstitutionStrategy::GROEBNER) {
+				auto res = algsubs::timed_groebner(p, polynomials);
+				if (res) return res;
+				CARL_LOG_DEBUG("carl.algsubs", "Gröbner bases failed, using resultants");
+			}
+			return algsubs::timed_resultant(p, polynomials);
+		}
+		case AlgebraicSubstitutionStrategy::RACE: {
+			auto deadline = std::chrono::steady_clock::now() + algebraic_substitution_race_budget;
+			auto res = algsubs::timed_resultant(p, polynomials, deadline);
+			if (res || std::chrono::steady_clock::now() < deadline) return res;
+			CARL_LOG_DEBUG("carl.algsubs", "Resultants did not finish in time, using Gröbner bases");
+			CARL_CALL_STATISTICS(++algsubs::statistics().race_cancelled);
+			res = algsubs::timed_groebner(p, polynomials);
+			if (res) return res;
+			CARL_LOG_DEBUG("carl.algsubs", "Gröbner bases failed, using resultants");
+			return algsubs::timed_resultant(p, polynomials);
+		}
 		case AlgebraicSubstitutionStrategy::RESULTANT:
 		default:
-			return algebraic_substitution_resultant(p, polynomials);
+			return algsubs::timed_resultant(p, polynomials);
 	}
 }
 
@@ -174,9 +352,16 @@ std::optional<UnivariatePolynomial<Number>> algebraic_substitution(
 		case AlgebraicSubstitutionStrategy::GROEBNER:
 			return algebraic_substitution_groebner(polynomials, variables);
 		case AlgebraicSubstitutionStrategy::RESULTANT:
-		default:
 			return algebraic_substitution_resultant(polynomials, variables);
+		default: {
+			auto p = carl::to_univariate_polynomial(polynomials.back(), variables.back());
+			std::vector<UnivariatePolynomial<MultivariatePolynomial<Number>>> polys;
+			for (std::size_t i = 0; i < polynomials.size() - 1; ++i) {
+				polys.emplace_back(carl::to_univariate_polynomial(polynomials[i], variables[i]));
+			}
+			return algebraic_substitution(p, polys, strategy);
+		}
 	}
 }
 
-}
\ No newline at end of file
+}
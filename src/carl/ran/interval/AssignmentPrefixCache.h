@@ -0,0 +1,169 @@
+#pragma once
+
+#include <carl/core/MultivariatePolynomial.h>
+#include <carl/core/UnivariatePolynomial.h>
+#include <carl/core/polynomialfunctions/Representation.h>
+#include <carl/core/polynomialfunctions/Resultant.h>
+#include <carl/core/polynomialfunctions/SquareFreePart.h>
+#include <carl/core/polynomialfunctions/Substitution.h>
+
+#include "ran_interval.h"
+#include "RootCountingData.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace carl::ran::interval {
+
+/**
+ * Caches partially substituted polynomials for every prefix of a variable assignment.
+ *
+ * Lifting in a cylindrical algebraic decomposition evaluates many polynomials on sample points
+ * that share all coordinates except for the last one.
+ * The cache represents such an assignment as a sequence of levels, one for each variable.
+ * Every level stores the polynomials with the values of this and all previous levels substituted:
+ * rational values are plugged in directly, and real algebraic numbers are eliminated by a resultant with their defining polynomial.
+ * When the assignment changes (see assign()), all levels of the longest common prefix are kept,
+ * such that substituting into a polynomial only does the work for the levels that changed.
+ *
+ * The result of the substitution is a univariate polynomial whose real roots include the values we are interested in:
+ * for real_roots() these are the roots of the polynomial at the current assignment, for evaluate() this is the value of the polynomial.
+ * Both functions have overloads that take a cache instead of an assignment.
+ */
+template<typename Number>
+class AssignmentPrefixCache {
+public:
+	using RAN = real_algebraic_number_interval<Number>;
+	using Polynomial = MultivariatePolynomial<Number>;
+	using UPolynomial = UnivariatePolynomial<Polynomial>;
+
+private:
+	struct Level {
+		Variable variable;
+		RAN value;
+		/// Whether the value was not rational when the level was created, i.e. it may have been eliminated by a resultant.
+		bool algebraic;
+		/// The polynomials with the values up to this level substituted, indexed by the original polynomial.
+		std::map<UPolynomial, UPolynomial> substitutions;
+		/// The polynomials used by evaluate() if the assignment ends at this level, indexed by the original polynomial.
+		std::map<Polynomial, std::shared_ptr<const RootCountingData<Number>>> evaluations;
+	};
+
+	std::vector<Level> mLevels;
+	/// The current assignment as a map, as needed for evaluation.
+	ran_assignment_t<RAN> mModel;
+	/// The variable representing the value of a polynomial in evaluate().
+	Variable mValueVariable = freshRealVariable();
+	/// Number of levels whose substitution was taken from the cache resp. computed by substitute().
+	std::size_t mReusedLevels = 0;
+	std::size_t mComputedLevels = 0;
+
+	/// Substitutes the value of the given level into p.
+	UPolynomial substitute_level(const UPolynomial& p, const Level& level) const {
+		if (!p.has(level.variable)) return p;
+		// The value may have become rational by refinement since the level was created.
+		if (level.value.is_numeric()) {
+			UPolynomial res = p;
+			substitute_inplace(res, level.variable, Polynomial(level.value.value()));
+			return res;
+		}
+		auto defining = replace_main_variable(level.value.polynomial(), level.variable).template convert<Polynomial>();
+		UPolynomial cur = pseudo_remainder(switch_main_variable(p, level.variable), defining);
+		CARL_LOG_TRACE("carl.ran.prefixcache", "Computing resultant of " << cur << " and " << defining);
+		cur = carl::resultant(cur, defining);
+		return switch_main_variable(cur, p.mainVar());
+	}
+
+public:
+	/// Substitutes all levels into p, reusing the substitutions of the longest prefix that already knows p.
+	const UPolynomial& substitute(const UPolynomial& p) {
+		std::size_t level = mLevels.size();
+		while (level > 0 && mLevels[level - 1].substitutions.find(p) == mLevels[level - 1].substitutions.end()) {
+			--level;
+		}
+		CARL_LOG_TRACE("carl.ran.prefixcache", "Reusing " << level << " of " << mLevels.size() << " levels for " << p);
+		mReusedLevels += level;
+		mComputedLevels += mLevels.size() - level;
+		const UPolynomial* cur = (level == 0) ? &p : &mLevels[level - 1].substitutions.at(p);
+		for (; level < mLevels.size(); ++level) {
+			UPolynomial res = substitute_level(*cur, mLevels[level]);
+			cur = &mLevels[level].substitutions.emplace(p, std::move(res)).first->second;
+		}
+		return *cur;
+	}
+
+	/// Checks whether some variable of p is assigned to a real algebraic number that may have been eliminated by a resultant.
+	/// In this case, the result of substitute() may have additional roots.
+	bool has_algebraic_level(const UPolynomial& p) const {
+		return std::any_of(mLevels.begin(), mLevels.end(), [&p](const auto& l){ return l.algebraic && p.has(l.variable); });
+	}
+
+	/// Number of levels whose substitution was reused by substitute() so far.
+	std::size_t reused_levels() const {
+		return mReusedLevels;
+	}
+	/// Number of levels whose substitution was computed by substitute() so far.
+	std::size_t computed_levels() const {
+		return mComputedLevels;
+	}
+
+	/// The current assignment.
+	const ran_assignment_t<RAN>& model() const {
+		return mModel;
+	}
+
+	/// Appends a level, i.e. extends the current assignment by v = value.
+	void push(Variable v, const RAN& value) {
+		assert(mModel.find(v) == mModel.end());
+		mLevels.push_back(Level{v, value, !value.is_numeric(), {}, {}});
+		mModel.emplace(v, value);
+	}
+
+	/// Removes the last level.
+	void pop() {
+		assert(!mLevels.empty());
+		mModel.erase(mLevels.back().variable);
+		mLevels.pop_back();
+	}
+
+	/**
+	 * Makes the given assignment the current one.
+	 * The levels of the longest common prefix with the current assignment are kept.
+	 */
+	void assign(const ordered_ran_assignment_t<RAN>& assignment) {
+		std::size_t common = 0;
+		while (common < mLevels.size() && common < assignment.size()
+			&& mLevels[common].variable == assignment[common].first
+			&& mLevels[common].value == assignment[common].second) {
+			++common;
+		}
+		while (mLevels.size() > common) pop();
+		for (std::size_t i = common; i < assignment.size(); ++i) {
+			push(assignment[i].first, assignment[i].second);
+		}
+	}
+
+	/**
+	 * Computes the square-free part of the substitution of the current assignment into v - p, where v is a fresh variable.
+	 * Its real roots include the value of p.
+	 * @return The result or nullptr if p has variables that are not assigned.
+	 */
+	std::shared_ptr<const RootCountingData<Number>> evaluation_polynomial(const Polynomial& p) {
+		if (!mLevels.empty()) {
+			auto it = mLevels.back().evaluations.find(p);
+			if (it != mLevels.back().evaluations.end()) return it->second;
+		}
+		const auto& res = substitute(UPolynomial(mValueVariable, {-p, Polynomial(1)}));
+		if (!res.isUnivariate()) return nullptr;
+		auto result = std::make_shared<const RootCountingData<Number>>(carl::squareFreePart(res.toNumberCoefficients()));
+		if (!mLevels.empty()) {
+			mLevels.back().evaluations.emplace(p, result);
+		}
+		return result;
+	}
+};
+
+}
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <carl/core/UnivariatePolynomial.h>
+#include <carl/core/polynomialfunctions/TaylorShift.h>
+#include <carl/core/logging.h>
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+namespace carl::ran::interval {
+
+/**
+ * Real root isolation within the open unit interval based on Descartes' rule of signs.
+ *
+ * Works on a square-free polynomial with integer coefficients q and isolates its roots within (0,1),
+ * either by the bisection of Vincent-Collins-Akritas or by the continued fraction method of Akritas.
+ * In both cases, the polynomial is transformed by Taylor shifts (see taylor_shift_by_one())
+ * such that the number of sign variations of its coefficients bounds the number of roots in the current interval.
+ * The isolating intervals are open with rational endpoints that are no roots of q.
+ */
+template<typename Number>
+class DescartesRootIsolation {
+public:
+	using Integer = typename IntegralType<Number>::type;
+	using Coefficients = std::vector<Integer>;
+
+private:
+	/// The isolating intervals, given by their lower and upper endpoints.
+	std::vector<std::pair<Number, Number>> mIntervals;
+	/// The rational roots.
+	std::vector<Number> mRoots;
+
+	/// Number of sign variations in the coefficient sequence, ignoring zeros.
+	static std::size_t sign_variations(const Coefficients& q) {
+		std::size_t res = 0;
+		Sign last = Sign::ZERO;
+		for (const auto& c: q) {
+			Sign s = carl::sgn(c);
+			if (s == Sign::ZERO) continue;
+			if (last != Sign::ZERO && s != last) ++res;
+			last = s;
+		}
+		return res;
+	}
+
+	/// Divides by x as long as zero is a root.
+	static void eliminate_zero_root(Coefficients& q) {
+		auto it = std::find_if(q.begin(), q.end(), [](const auto& c){ return !carl::isZero(c); });
+		q.erase(q.begin(), it);
+	}
+
+	/// Bounds the number of roots within (0,1) by the sign variations of (x+1)^n q(1/(x+1)).
+	static std::size_t unit_interval_variations(const Coefficients& q) {
+		Coefficients t(q.rbegin(), q.rend());
+		taylor_shift_by_one(t);
+		return sign_variations(t);
+	}
+
+	/// Replaces q by 2^n q(x/2), where n is the degree of q.
+	static void halve(Coefficients& q) {
+		Integer factor = carl::constant_one<Integer>::get();
+		for (std::size_t i = q.size(); i-- > 0;) {
+			q[i] *= factor;
+			factor *= Integer(2);
+		}
+	}
+
+	/// Lower bound for the positive roots as exponent of two, based on the bound by Kioustelidis applied to the reversed polynomial.
+	static long positive_lower_bound(const Coefficients& q) {
+		assert(!q.empty() && !carl::isZero(q.front()));
+		// Roots of q within (0,inf) correspond to roots of the reversed polynomial, we bound those from above.
+		const Integer& lead = q.front();
+		bool negate = carl::sgn(lead) == Sign::NEGATIVE;
+		std::optional<long> res;
+		for (std::size_t i = 1; i < q.size(); ++i) {
+			Sign s = carl::sgn(q[i]);
+			if (s == Sign::ZERO || (s == Sign::NEGATIVE) == negate) continue;
+			// (|q_i| / |lead|)^(1/i) < 2^ceil((bits(q_i) - bits(lead) + 1) / i)
+			long bits = long(carl::bitsize(q[i])) - long(carl::bitsize(lead)) + 1;
+			long e = bits >= 0 ? (bits + long(i) - 1) / long(i) : -((-bits) / long(i));
+			if (!res || e > *res) res = e;
+		}
+		if (!res) return 0;
+		return -(*res + 1);
+	}
+
+	/// Adds the interval between two endpoints in any order.
+	void add_interval(Number&& x, Number&& y) {
+		if (y < x) std::swap(x, y);
+		mIntervals.emplace_back(std::move(x), std::move(y));
+	}
+
+public:
+	/**
+	 * Isolates the roots within (0,1) by the Vincent-Collins-Akritas bisection.
+	 * @param q Square-free polynomial with integer coefficients.
+	 */
+	void isolate_by_bisection(Coefficients q) {
+		struct Node {
+			Coefficients q;
+			/// The node represents the interval (c / 2^k, (c+1) / 2^k).
+			Integer c;
+			std::size_t k;
+		};
+		eliminate_zero_root(q);
+		std::vector<Node> stack;
+		stack.push_back(Node{std::move(q), carl::constant_zero<Integer>::get(), 0});
+		while (!stack.empty()) {
+			Node cur = std::move(stack.back());
+			stack.pop_back();
+			if (cur.q.size() < 2) continue;
+			std::size_t variations = unit_interval_variations(cur.q);
+			if (variations == 0) continue;
+			Number width = carl::constant_one<Number>::get() / carl::pow(Number(2), cur.k);
+			if (variations == 1) {
+				mIntervals.emplace_back(Number(cur.c) * width, Number(cur.c + 1) * width);
+				continue;
+			}
+			halve(cur.q);
+			Coefficients right = cur.q;
+			taylor_shift_by_one(right);
+			Integer c = cur.c * Integer(2);
+			if (carl::isZero(right.front())) {
+				mRoots.emplace_back(Number(c + 1) * width / Number(2));
+				eliminate_zero_root(right);
+			}
+			stack.push_back(Node{std::move(right), c + 1, cur.k + 1});
+			stack.push_back(Node{std::move(cur.q), c, cur.k + 1});
+		}
+	}
+
+	/**
+	 * Isolates the roots within (0,1) by the continued fraction method.
+	 * The unit interval is mapped to (0,inf), where the roots are separated by shifts by lower root bounds and splitting at one.
+	 * @param q Square-free polynomial with integer coefficients.
+	 */
+	void isolate_by_continued_fractions(Coefficients q) {
+		struct Node {
+			Coefficients q;
+			/// The roots t of q correspond to the roots x = (a t + b) / (c t + d) of the input.
+			Integer a, b, c, d;
+		};
+		eliminate_zero_root(q);
+		// x = t / (t + 1) maps (0,inf) to (0,1), hence consider (t+1)^n q(t/(t+1)).
+		std::reverse(q.begin(), q.end());
+		taylor_shift_by_one(q);
+		std::reverse(q.begin(), q.end());
+		eliminate_zero_root(q);
+		// A root at one has been mapped to infinity, which lowers the degree.
+		while (!q.empty() && carl::isZero(q.back())) q.pop_back();
+		const Integer zero = carl::constant_zero<Integer>::get();
+		const Integer one = carl::constant_one<Integer>::get();
+		std::vector<Node> stack;
+		stack.push_back(Node{std::move(q), one, zero, one, one});
+		while (!stack.empty()) {
+			Node cur = std::move(stack.back());
+			stack.pop_back();
+			if (cur.q.size() < 2) continue;
+			std::size_t variations = sign_variations(cur.q);
+			if (variations == 0) continue;
+			if (variations == 1) {
+				// The endpoints are the images of t = 0 and t = inf.
+				add_interval(Number(cur.b) / Number(cur.d), Number(cur.a) / Number(cur.c));
+				continue;
+			}
+			long bound = positive_lower_bound(cur.q);
+			if (bound >= 0) {
+				// All roots are larger than 2^bound, shift by it.
+				Integer shift = carl::constant_one<Integer>::get();
+				for (long i = 0; i < bound; ++i) shift *= Integer(2);
+				if (bound == 0) {
+					taylor_shift_by_one(cur.q);
+				} else {
+					Integer factor = carl::constant_one<Integer>::get();
+					for (std::size_t i = 1; i < cur.q.size(); ++i) {
+						factor *= shift;
+						cur.q[i] *= factor;
+					}
+					taylor_shift_by_one(cur.q);
+					factor = carl::constant_one<Integer>::get();
+					for (std::size_t i = 1; i < cur.q.size(); ++i) {
+						factor *= shift;
+						cur.q[i] /= factor;
+					}
+				}
+				cur.b += cur.a * shift;
+				cur.d += cur.c * shift;
+				if (carl::isZero(cur.q.front())) {
+					mRoots.emplace_back(Number(cur.b) / Number(cur.d));
+					eliminate_zero_root(cur.q);
+				}
+				if (sign_variations(cur.q) < 2) {
+					stack.push_back(std::move(cur));
+					continue;
+				}
+			}
+			// Roots larger than one: q(t + 1)
+			Coefficients upper = cur.q;
+			taylor_shift_by_one(upper);
+			// Roots smaller than one: (t+1)^n q(1/(t+1))
+			Coefficients lower(cur.q.rbegin(), cur.q.rend());
+			taylor_shift_by_one(lower);
+			if (carl::isZero(upper.front())) {
+				mRoots.emplace_back(Number(cur.a + cur.b) / Number(cur.c + cur.d));
+				eliminate_zero_root(upper);
+				eliminate_zero_root(lower);
+			}
+			stack.push_back(Node{std::move(lower), cur.b, cur.a + cur.b, cur.d, cur.c + cur.d});
+			stack.push_back(Node{std::move(upper), cur.a, cur.a + cur.b, cur.c, cur.c + cur.d});
+		}
+	}
+
+	/// The isolating intervals.
+	const auto& intervals() const {
+		return mIntervals;
+	}
+
+	/// The roots that were found exactly.
+	const auto& roots() const {
+		return mRoots;
+	}
+};
+
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <carl/core/MultivariatePolynomial.h>
+#include <carl/core/UnivariatePolynomial.h>
+#include <carl/core/Variable.h>
+#include <carl/interval/Interval.h>
+#include <carl/interval/power.h>
+
+#include <carl-statistics/carl-statistics.h>
+
+#include <cmath>
+#include <limits>
+#include <map>
+#include <optional>
+
+namespace carl::ran::interval {
+
+/**
+ * Floating-point filter for queries on interval representations of real algebraic numbers.
+ *
+ * Exact sign determination (via Sturm sequences, resultants or refinement) is expensive,
+ * although in most cases the answer can be read off a coarse enclosure.
+ * The functions here evaluate with double intervals whose operations are rounded outwards,
+ * and all conversions from exact numbers to doubles are rounded outwards as well.
+ * Thus, the results are sound enclosures and a filter only answers if the answer is certain.
+ * Otherwise, std::nullopt is returned and the caller falls back to exact methods.
+ */
+namespace filter {
+
+/// Rounds the double approximation of n outwards to an interval that is guaranteed to contain n.
+template<typename Number>
+std::optional<Interval<double>> enclose(const Number& n) {
+	if (carl::isZero(n)) return Interval<double>(0.0);
+	double d = carl::toDouble(n);
+	if (!std::isfinite(d)) return std::nullopt;
+	// The conversion is at most one unit in the last place off.
+	return Interval<double>(
+		std::nextafter(d, -std::numeric_limits<double>::infinity()), BoundType::WEAK,
+		std::nextafter(d, std::numeric_limits<double>::infinity()), BoundType::WEAK
+	);
+}
+
+/// Rounds the bounds of i outwards, the result contains the closure of i.
+template<typename Number>
+std::optional<Interval<double>> enclose(const Interval<Number>& i) {
+	assert(i.lowerBoundType() != BoundType::INFTY && i.upperBoundType() != BoundType::INFTY);
+	auto lower = enclose(i.lower());
+	auto upper = enclose(i.upper());
+	if (!lower || !upper) return std::nullopt;
+	return Interval<double>(lower->lower(), BoundType::WEAK, upper->upper(), BoundType::WEAK);
+}
+
+/// Checks that both bounds of the interval are finite.
+inline bool is_finite(const Interval<double>& i) {
+	return i.lowerBoundType() != BoundType::INFTY && i.upperBoundType() != BoundType::INFTY
+		&& std::isfinite(i.lower()) && std::isfinite(i.upper());
+}
+
+/**
+ * Evaluates p on x by the Horner scheme in double interval arithmetic.
+ * @return An enclosure of the image of x, or std::nullopt if the computation leaves the range of doubles.
+ */
+template<typename Number>
+std::optional<Interval<double>> evaluate(const UnivariatePolynomial<Number>& p, const Interval<double>& x) {
+	const auto& coeffs = p.coefficients();
+	if (coeffs.empty()) return Interval<double>(0.0);
+	auto res = enclose(coeffs.back());
+	if (!res) return std::nullopt;
+	for (std::size_t i = coeffs.size() - 1; i-- > 0;) {
+		auto c = enclose(coeffs[i]);
+		if (!c) return std::nullopt;
+		*res = *res * x + *c;
+		if (!is_finite(*res)) return std::nullopt;
+	}
+	return res;
+}
+
+/**
+ * Evaluates p on the box given by map in double interval arithmetic.
+ * @return An enclosure of the image of the box, or std::nullopt if some variable of p is not in map
+ * or the computation leaves the range of doubles.
+ */
+template<typename Coeff, typename Ordering, typename Policies>
+std::optional<Interval<double>> evaluate(const MultivariatePolynomial<Coeff, Ordering, Policies>& p, const std::map<Variable, Interval<double>>& map) {
+	Interval<double> res(0.0);
+	for (const auto& term: p) {
+		auto t = enclose(term.coeff());
+		if (!t) return std::nullopt;
+		if (term.monomial()) {
+			for (const auto& [var, exp]: *term.monomial()) {
+				auto it = map.find(var);
+				if (it == map.end()) return std::nullopt;
+				*t *= carl::pow(it->second, exp);
+			}
+		}
+		res += *t;
+		if (!is_finite(res)) return std::nullopt;
+	}
+	return res;
+}
+
+/// Returns the sign of all numbers in i, if it is unique.
+inline std::optional<Sign> sgn(const std::optional<Interval<double>>& i) {
+	if (!i) return std::nullopt;
+	if (i->isPositive()) return Sign::POSITIVE;
+	if (i->isNegative()) return Sign::NEGATIVE;
+	if (i->isZero()) return Sign::ZERO;
+	return std::nullopt;
+}
+
+#ifdef CARL_DEVOPTION_Statistics
+
+class FilterStatistics : public statistics::Statistics {
+	struct counter {
+		std::size_t queries = 0;
+		std::size_t hits = 0;
+		void operator()(bool hit) {
+			++queries;
+			if (hit) ++hits;
+		}
+	};
+	void add_counter(const std::string& name, const counter& c) {
+		Statistics::addKeyValuePair(name + "_queries", c.queries);
+		Statistics::addKeyValuePair(name + "_hits", c.hits);
+		Statistics::addKeyValuePair(name + "_hit_rate", c.queries == 0 ? 0.0 : double(c.hits) / double(c.queries));
+	}
+public:
+	/// Sign of a polynomial at a real algebraic number.
+	counter sgn;
+	/// Comparison of two real algebraic numbers with overlapping isolating intervals.
+	counter compare;
+	/// Comparison of a real algebraic number with a rational number within its isolating interval.
+	counter compare_number;
+	/// Evaluation of a constraint on an assignment of real algebraic numbers.
+	counter constraint;
+
+	void collect() {
+		add_counter("sgn", sgn);
+		add_counter("compare", compare);
+		add_counter("compare_number", compare_number);
+		add_counter("constraint", constraint);
+	}
+};
+
+static auto& statistics() {
+	static CARL_INIT_STATISTICS(FilterStatistics, stats, "ran_interval_filter");
+	return stats;
+}
+
+#endif
+
+}
+}
@@ -8,19 +8,43 @@
 #include <carl/core/polynomialfunctions/Factorization_univariate.h>
 #include <carl/core/polynomialfunctions/SignVariations.h>
 #include <carl/io/streamingOperators.h>
-#include <carl/core/polynomialfunctions/EigenWrapper.h>
+#include <carl/core/polynomialfunctions/AberthRootApproximation.h>
 #include <carl/core/polynomialfunctions/Evaluation.h>
 #include <carl/core/polynomialfunctions/RootElimination.h>
 
+#include "DescartesRootIsolation.h"
+
 namespace carl::ran::interval {
 
 using carl::operator<<;
 
+/**
+ * Methods to isolate the real roots of a univariate polynomial.
+ */
+enum class RootIsolationMethod {
+	/// Bisection based on Sturm-like sign variation counting, initialized by numerical approximations.
+	BISECTION,
+	/// Bisection of Vincent-Collins-Akritas based on Descartes' rule of signs.
+	DESCARTES,
+	/// Continued fraction method based on Descartes' rule of signs.
+	CONTINUED_FRACTIONS
+};
+
+inline std::ostream& operator<<(std::ostream& os, RootIsolationMethod method) {
+	switch (method) {
+		case RootIsolationMethod::BISECTION: return os << "bisection";
+		case RootIsolationMethod::DESCARTES: return os << "descartes";
+		case RootIsolationMethod::CONTINUED_FRACTIONS: return os << "continued fractions";
+	}
+	return os;
+}
+
 /**
  * Compact class to isolate real roots from a univariate polynomial using bisection.
  * 
  * After some rather easy preprocessing (make polynomial square-free, eliminate zero roots, solve low-degree polynomial trivially, use root bounds to shrink the interval) 
  * we employ bisection which can optionally be initialized by approximations.
+ * Alternatively, the roots are isolated by DescartesRootIsolation on integer coefficients, see RootIsolationMethod.
  */
 template<typename Number>
 class RealRootIsolation {
@@ -35,20 +59,18 @@ class RealRootIsolation {
 	std::vector<real_algebraic_number_interval<Number>> mRoots;
 	/// The bounding interval.
 	Interval<Number> mInterval;
-	/// The sturm sequence for mPolynomial.
-	// std::optional<std::vector<UnivariatePolynomial<Number>>> mSturmSequence;
-
-	/// Return the sturm sequence for mPolynomial, create it if necessary.
-	// const auto& sturm_sequence() {
-	// 	if (!mSturmSequence) {
-	// 		mSturmSequence = carl::sturm_sequence(mPolynomial);
-	// 	}
-	// 	return *mSturmSequence;
-	// }
-	/// Reset the sturm sequence, used if the polynomial was modified.
-	// void reset_sturm_sequence() {
-	// 	mSturmSequence.reset();
-	// }
+	/// The isolation method.
+	RootIsolationMethod mMethod;
+	/// The root counting data for mPolynomial, shared with all roots isolated from the same polynomial.
+	std::shared_ptr<const RootCountingData<Number>> mRootCounting;
+
+	/// Return the root counting data for mPolynomial, create it if necessary or if mPolynomial was modified.
+	const auto& root_counting() {
+		if (!mRootCounting || mRootCounting->polynomial() != mPolynomial) {
+			mRootCounting = std::make_shared<const RootCountingData<Number>>(mPolynomial);
+		}
+		return mRootCounting;
+	}
 
 	/// Handle zero roots (p(0) == 0)
 	void eliminate_zero_roots() {
@@ -119,7 +141,7 @@ class RealRootIsolation {
 
 	void add_trivial_root(const Interval<Number>& i) {
 		CARL_LOG_TRACE("carl.ran.realroots", "Add trivial root " << i);
-		mRoots.emplace_back(mPolynomial, i);
+		mRoots.emplace_back(mPolynomial, i, root_counting());
 	}
 
 	/// Use root bounds to shrink mInterval.
@@ -133,14 +155,13 @@ class RealRootIsolation {
 	void add_root(const Number& n) {
 		CARL_LOG_TRACE("carl.ran.realroots", "Add root " << n);
 		assert(carl::is_root_of(mPolynomial, n));
-		// reset_sturm_sequence();
 		eliminate_root(mPolynomial, n);
 		mRoots.emplace_back(n);
 	}
 	/// Add a root to mRoots, based on an isolating interval.
 	void add_root(const Interval<Number>& i) {
 		CARL_LOG_TRACE("carl.ran.realroots", "Add root " << i);
-		mRoots.emplace_back(mPolynomial, i);
+		mRoots.emplace_back(mPolynomial, i, root_counting());
 	}
 
 	/// Check whether the interval bounds are roots.
@@ -161,68 +182,92 @@ class RealRootIsolation {
 		return found_root;
 	}
 
+	/// Converts x to a rational, rounded down (or up) to a multiple of 2^k.
+	static Number round_to_dyadic(long double x, int k, bool up) {
+		long double m = std::ldexp(x, -k);
+		m = up ? std::ceil(m) : std::floor(m);
+		Number res(static_cast<long>(m));
+		Number factor = carl::pow(Number(2), uint(std::abs(k)));
+		return k >= 0 ? Number(res * factor) : Number(res / factor);
+	}
+
+	/// Handles a rational number that is used as an interval endpoint: if it is a root, it is removed from mPolynomial.
+	void check_endpoint(const Number& n) {
+		if (!carl::is_root_of(mPolynomial, n)) return;
+		if (mInterval.contains(n)) {
+			add_root(n);
+		} else {
+			eliminate_root(mPolynomial, n);
+		}
+	}
+
 	/**
-	 * Initialize the bisection queue using approximations.
-	 * 
-	 * The main idea is that the eigenvalues of the companion matrix are the root of a polynomial.
-	 * This is implemented in eigen::root_approximation.
+	 * Isolates roots using approximations and fills the bisection queue with the remaining parts of mInterval.
+	 *
+	 * The approximations are computed by the Aberth-Ehrlich iteration in aberth::root_approximation,
+	 * which also yields an inclusion radius for every approximation.
 	 * We do:
-	 * - convert coefficients to doubles
-	 * - call eigen::root_approximation
-	 * - make approximations smaller, sort them, remove duplicates
-	 * - convert approximations to rationals
-	 * - create interval endpoints so that each interval contains a single approximation
-	 * - initialize queue from these endpoints
+	 * - take all approximations whose inclusion disc meets the real axis
+	 * - enclose the disc by an interval with dyadic endpoints and merge overlapping intervals
+	 * - check whether a small rational within the interval is a root
+	 * - confirm that the interval isolates a single root by counting sign variations; if so, add the root directly
+	 * - put all other intervals and the gaps in between into the queue
+	 * Hence, exact bisection is only needed for clusters of roots and for approximations that turn out to be wrong.
 	 */
 	void bisect_by_approximation(std::deque<Interval<Number>>& queue) {
 		assert(queue.empty());
-		// Convert polynomial coeffs to double
-		std::vector<double> coeffs;
-		for (const auto& n: mPolynomial.coefficients()) {
-			coeffs.emplace_back(toDouble(n));
-		}
-		CARL_LOG_DEBUG("carl.ran.realroots", "Double coeffs: " << coeffs);
-		
-		// Get approximations of the roots
-		std::vector<double> approx = carl::roots::eigen::root_approximation(coeffs);
-		// Sort and make them unique
-		for (double& a: approx) {
-			a = std::round(a*1000) / 1000;
+		assert(mInterval.lowerBoundType() != BoundType::INFTY && mInterval.upperBoundType() != BoundType::INFTY);
+		auto approx = carl::roots::aberth::root_approximation(mPolynomial);
+
+		// Candidate intervals for real roots
+		std::vector<std::pair<Number, Number>> candidates;
+		for (const auto& a: approx) {
+			long double center = a.value.real();
+			if (!std::isfinite(center) || !std::isfinite(a.radius)) continue;
+			if (std::abs(a.value.imag()) > a.radius) continue;
+			// Leave some room for rounding errors.
+			long double radius = std::max({2 * a.radius, std::ldexp(std::abs(center), -48), std::numeric_limits<long double>::min()});
+			int k = std::ilogb(radius) - 1;
+			candidates.emplace_back(round_to_dyadic(center - radius, k, false), round_to_dyadic(center + radius, k, true));
 		}
-		std::sort(approx.begin(), approx.end());
-		approx.erase(std::unique(approx.begin(), approx.end()), approx.end());
-		CARL_LOG_DEBUG("carl.ran.realroots", "Double approximations: " << approx);
-		// Convert to rationals
-		std::vector<Number> roots;
-		for (double r: approx) {
-			if (!isNumber(r)) continue;
-			Number n = carl::rationalize<Number>(r);
-			if (!mInterval.contains(n)) continue;
-			if (carl::is_root_of(mPolynomial, n)) {
-				add_root(n);
+		std::sort(candidates.begin(), candidates.end());
+		std::vector<std::pair<Number, Number>> merged;
+		for (auto& c: candidates) {
+			if (!merged.empty() && c.first <= merged.back().second) {
+				merged.back().second = std::max(merged.back().second, c.second);
+			} else {
+				merged.emplace_back(std::move(c));
 			}
-			roots.emplace_back(n);
 		}
-		CARL_LOG_DEBUG("carl.ran.realroots", "Approx roots: " << roots);
-
-		// Get interval endpoints
-		std::vector<Number> endpoints;
-		endpoints.emplace_back(mInterval.lower());
-		if (roots.size() > 0) {
-			for (std::size_t i = 0; i < roots.size() - 1; ++i) {
-				auto tmp = carl::sample(Interval<Number>(roots[i], BoundType::STRICT, roots[i+1], BoundType::STRICT));
-				if (carl::is_root_of(mPolynomial, tmp)) {
-					add_root(tmp);
-				}
-				endpoints.emplace_back(tmp);
+		CARL_LOG_DEBUG("carl.ran.realroots", "Candidates from " << approx.size() << " approximations: " << merged);
+
+		Number last = mInterval.lower();
+		for (const auto& m: merged) {
+			Number lower = std::max(m.first, mInterval.lower());
+			Number upper = std::min(m.second, mInterval.upper());
+			if (lower >= upper) continue;
+			check_endpoint(lower);
+			check_endpoint(upper);
+			if (last < lower) {
+				queue.emplace_back(last, BoundType::STRICT, lower, BoundType::STRICT);
+			}
+			last = upper;
+			Interval<Number> cur(lower, BoundType::STRICT, upper, BoundType::STRICT);
+			auto simple = carl::sample(cur, false);
+			if (carl::is_root_of(mPolynomial, simple)) {
+				add_root(simple);
+			}
+			auto variations = carl::sign_variations(mPolynomial, cur);
+			if (variations == 1) {
+				CARL_LOG_DEBUG("carl.ran.realroots", "Confirmed a single root within " << cur);
+				assert(root_counting()->count_real_roots(cur) == 1);
+				add_root(cur);
+			} else if (variations > 1) {
+				queue.emplace_back(cur);
 			}
 		}
-		endpoints.emplace_back(mInterval.upper());
-		CARL_LOG_DEBUG("carl.ran.realroots", "Endpoints: " << endpoints);
-
-		// Fill queue based on the endpoints
-		for (std::size_t i = 0; i < endpoints.size() - 1; ++i) {
-			queue.emplace_back(endpoints[i], BoundType::STRICT, endpoints[i+1], BoundType::STRICT);
+		if (last < mInterval.upper()) {
+			queue.emplace_back(last, BoundType::STRICT, mInterval.upper(), BoundType::STRICT);
 		}
 		CARL_LOG_DEBUG("carl.ran.realroots", "Queue: " << queue);
 	}
@@ -250,7 +295,7 @@ class RealRootIsolation {
 				CARL_LOG_DEBUG("carl.ran.realroots", "A single root within " << cur);
 				assert(!carl::is_root_of(mPolynomial, cur.lower()));
 				assert(!carl::is_root_of(mPolynomial, cur.upper()));
-				assert(count_real_roots(mPolynomial, cur) == 1);
+				assert(root_counting()->count_real_roots(cur) == 1);
 				add_root(cur);
 				continue;
 			}
@@ -265,6 +310,42 @@ class RealRootIsolation {
 		}
 	}
 
+	/**
+	 * Isolate by Descartes' rule of signs.
+	 * The polynomial is transformed to an integer polynomial whose roots in (0,1) correspond to the roots within mInterval.
+	 * Rational roots found on the way are removed from mPolynomial before the isolating intervals are turned into numbers,
+	 * such that no interval endpoint is a root of mPolynomial.
+	 */
+	void isolate_by_descartes() {
+		if (mInterval.isEmpty() || mInterval.isPointInterval()) return;
+		assert(mInterval.lowerBoundType() != BoundType::INFTY && mInterval.upperBoundType() != BoundType::INFTY);
+		const Number& lower = mInterval.lower();
+		Number width = mInterval.upper() - lower;
+		// Strict bounds may still be roots.
+		if (carl::is_root_of(mPolynomial, lower)) eliminate_root(mPolynomial, lower);
+		if (carl::is_root_of(mPolynomial, mInterval.upper())) eliminate_root(mPolynomial, mInterval.upper());
+		if (mPolynomial.degree() == 0) return;
+
+		// q(x) = p(lower + width * x)
+		auto q = detail_sign_variations::scale(carl::taylor_shift(mPolynomial, lower), width);
+		auto integral = q.coprimeCoefficients();
+		typename DescartesRootIsolation<Number>::Coefficients coeffs(integral.coefficients().begin(), integral.coefficients().end());
+		CARL_LOG_DEBUG("carl.ran.realroots", "Isolating by " << mMethod << " on " << coeffs);
+
+		DescartesRootIsolation<Number> dri;
+		if (mMethod == RootIsolationMethod::CONTINUED_FRACTIONS) {
+			dri.isolate_by_continued_fractions(std::move(coeffs));
+		} else {
+			dri.isolate_by_bisection(std::move(coeffs));
+		}
+		for (const auto& r: dri.roots()) {
+			add_root(Number(lower + width * r));
+		}
+		for (const auto& i: dri.intervals()) {
+			add_root(Interval<Number>(lower + width * i.first, BoundType::STRICT, lower + width * i.second, BoundType::STRICT));
+		}
+	}
+
 	/// Do actual root isolation.
 	void compute_roots() {
 		// Handle zero polynomial
@@ -288,12 +369,16 @@ class RealRootIsolation {
 			}
 		}
 
-		// Now do actual bisection
-		isolate_by_bisection();
+		if (mMethod == RootIsolationMethod::BISECTION) {
+			// Now do actual bisection
+			isolate_by_bisection();
+		} else {
+			isolate_by_descartes();
+		}
 	}
 
 public:
-	RealRootIsolation(const UnivariatePolynomial<Number>& polynomial, const Interval<Number>& interval): mPolynomial(carl::squareFreePart(polynomial)), mInterval(interval) {
+	RealRootIsolation(const UnivariatePolynomial<Number>& polynomial, const Interval<Number>& interval, RootIsolationMethod method = RootIsolationMethod::BISECTION): mPolynomial(carl::squareFreePart(polynomial)), mInterval(interval), mMethod(method) {
 		CARL_LOG_DEBUG("carl.ran.realroots", "Reduced " << polynomial << " to " << mPolynomial);
 	}
 
@@ -307,7 +392,6 @@ public:
 				CARL_LOG_DEBUG("carl.ran.realroots", "Coputing root of factor " << factor);
 				mPolynomial = factor.first;
 				mInterval = interval;
-				// reset_sturm_sequence();
 				compute_roots();
 			}
 		} else {
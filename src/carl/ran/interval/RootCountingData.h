@@ -0,0 +1,53 @@
+#pragma once
+
+#include <carl/core/UnivariatePolynomial.h>
+#include <carl/core/polynomialfunctions/RootCounting.h>
+#include <carl/core/polynomialfunctions/SturmSequence.h>
+#include <carl/interval/Interval.h>
+
+#include <optional>
+#include <vector>
+
+namespace carl::ran::interval {
+
+/**
+ * A polynomial together with data for counting its real roots, namely its Sturm sequence, which is computed on demand.
+ *
+ * Computing a Sturm sequence is expensive compared to evaluating it,
+ * hence this data is shared (via std::shared_ptr) by all numbers defined by the same polynomial
+ * and stored together with the results of algebraic substitutions that are evaluated repeatedly.
+ * As Sturm sequences are only evaluated at numbers, the main variable of the polynomial is irrelevant.
+ */
+template<typename Number>
+class RootCountingData {
+	using Polynomial = UnivariatePolynomial<Number>;
+
+	Polynomial m_polynomial;
+	mutable std::optional<std::vector<Polynomial>> m_sturm_sequence;
+
+public:
+	explicit RootCountingData(Polynomial p): m_polynomial(std::move(p)) {}
+
+	const Polynomial& polynomial() const {
+		return m_polynomial;
+	}
+
+	/// Returns the Sturm sequence of the polynomial, create it if necessary.
+	const std::vector<Polynomial>& sturm_sequence() const {
+		if (!m_sturm_sequence) {
+			m_sturm_sequence = carl::sturm_sequence(m_polynomial);
+		}
+		return *m_sturm_sequence;
+	}
+
+	/**
+	 * Counts the real roots within the given interval, whose bounds must not be roots.
+	 * @param i Interval with finite bounds.
+	 * @return Number of real roots within the interval.
+	 */
+	int count_real_roots(const Interval<Number>& i) const {
+		return carl::count_real_roots(sturm_sequence(), i);
+	}
+};
+
+}
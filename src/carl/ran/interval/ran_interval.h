@@ -13,18 +13,29 @@
 #include <carl/interval/IntervalEvaluation.h>
 #include <carl/interval/set_theory.h>
 
+#include "FloatingPointFilter.h"
+#include "RootCountingData.h"
+
 #include "../ran_common.h"
 #include "../ran_operations.h"
 #include "../ran_operations_number.h"
 
+#include <algorithm>
 #include <list>
+#include <map>
 #include <boost/logic/tribool.hpp>
 
+namespace carl::ran::interval {
+template<typename Number>
+class AssignmentPrefixCache;
+}
+
 namespace carl {
 
 template<typename Number>
 class real_algebraic_number_interval {
 	using Polynomial = UnivariatePolynomial<Number>;
+	using Integer = typename IntegralType<Number>::type;
 	static const Variable auxVariable;
 
 	template<typename Num>
@@ -34,10 +45,13 @@ class real_algebraic_number_interval {
 	friend bool compare(const real_algebraic_number_interval<Num>&, const Num&, const Relation);
 
 	template<typename Num, typename Poly>
-	friend boost::tribool evaluate(const Constraint<Poly>&, const ran::ran_assignment_t<real_algebraic_number_interval<Num>>&, bool, bool);
+	friend boost::tribool evaluate(const Constraint<Poly>&, const ran::ran_assignment_t<real_algebraic_number_interval<Num>>&, bool, bool, ran::interval::AssignmentPrefixCache<Num>*);
+
+	template<typename Num>
+	friend std::optional<real_algebraic_number_interval<Num>> evaluate(MultivariatePolynomial<Num>, const ran::ran_assignment_t<real_algebraic_number_interval<Num>>&, bool, ran::interval::AssignmentPrefixCache<Num>*);
 
 	template<typename Num>
-	friend std::optional<real_algebraic_number_interval<Num>> evaluate(MultivariatePolynomial<Num>, const ran::ran_assignment_t<real_algebraic_number_interval<Num>>&, bool);
+	friend std::shared_ptr<const ran::interval::RootCountingData<Num>> evaluation_polynomial(const MultivariatePolynomial<Num>&, const ran::ran_assignment_t<real_algebraic_number_interval<Num>>&, const std::map<Variable, Interval<Num>>&);
 
 	template<typename Num>
 	friend Num branching_point(const real_algebraic_number_interval<Num>& n);
@@ -69,6 +83,17 @@ private:
 		Interval<Number> interval;
 		/// Sign of polynomial at interval.lower()
 		Sign lower_sign;
+		/// Coprime integer coefficients of polynomial, created on demand for evaluation with integer arithmetic.
+		std::optional<std::vector<Integer>> integral_coefficients;
+		/// Enclosure of the number by doubles, created on demand for the floating-point filter. Unbounded if no such enclosure exists.
+		std::optional<Interval<double>> float_interval;
+		/// Binary logarithm of the number of subintervals for the next step of quadratic interval refinement.
+		std::size_t qir_exponent = 2;
+		/// Root counting data for polynomial, created on demand and shared with other numbers defined by the same polynomial.
+		std::shared_ptr<const ran::interval::RootCountingData<Number>> root_counting;
+		/// Results of algebraic substitutions of this number into polynomials, most recently used first and at most max_substitutions many.
+		std::list<std::pair<MultivariatePolynomial<Number>, std::shared_ptr<const ran::interval::RootCountingData<Number>>>> substitutions;
+		static constexpr std::size_t max_substitutions = 8;
 
 		content(const Interval<Number>& i)
 			: polynomial(std::nullopt), interval(i), lower_sign(Sign::ZERO) {}
@@ -76,10 +101,25 @@ private:
 			: polynomial(std::move(p)), interval(i), lower_sign(Sign::ZERO) {}
 		content(const Polynomial& p, const Interval<Number>& i)
 			: polynomial(p), interval(i), lower_sign(Sign::ZERO) {}
+		/// Looks up the result of substituting this number into p and marks it as most recently used.
+		std::shared_ptr<const ran::interval::RootCountingData<Number>> find_substitution(const MultivariatePolynomial<Number>& p) {
+			auto it = std::find_if(substitutions.begin(), substitutions.end(), [&p](const auto& s){ return s.first == p; });
+			if (it == substitutions.end()) return nullptr;
+			substitutions.splice(substitutions.begin(), substitutions, it);
+			return it->second;
+		}
+		/// Stores the result of substituting this number into p, evicting the least recently used result if necessary.
+		void add_substitution(const MultivariatePolynomial<Number>& p, std::shared_ptr<const ran::interval::RootCountingData<Number>> res) {
+			substitutions.emplace_front(p, std::move(res));
+			if (substitutions.size() > max_substitutions) substitutions.pop_back();
+		}
 		void simplify_to_point() {
 			assert(interval.isPointInterval());
 			polynomial = std::nullopt;
 			lower_sign = Sign::ZERO;
+			integral_coefficients = std::nullopt;
+			root_counting = nullptr;
+			substitutions.clear();
 		}
 	};
 
@@ -119,6 +159,9 @@ private:
 		assert(!interval_int().isPointInterval());
 		polynomial_int() = replaceVariable(p);
 		m_content->lower_sign = lower_sign;
+		m_content->integral_coefficients = std::nullopt;
+		m_content->root_counting = nullptr;
+		m_content->substitutions.clear();
 		assert(is_consistent());
 	}
 
@@ -132,7 +175,7 @@ private:
 		// assert(is_consistent());
 		assert(interval_int().contains(pivot));
 		assert(!interval_int().isPointInterval());
-		auto psgn = carl::sgn(carl::evaluate(polynomial_int(), pivot));
+		auto psgn = sgn_at(pivot);
 		if (psgn == Sign::ZERO) {
 			interval_int() = Interval<Number>(pivot, pivot);
 			m_content->simplify_to_point();
@@ -149,11 +192,132 @@ private:
 		}
 	}
 
+	/// Sign of the polynomial at the given point, evaluated with integer arithmetic only.
+	Sign sgn_at(const Number& x) const {
+		if (!m_content->integral_coefficients) {
+			auto integral = polynomial_int().coprimeCoefficients();
+			m_content->integral_coefficients = std::vector<Integer>(integral.coefficients().begin(), integral.coefficients().end());
+		}
+		return carl::sgn_at(*m_content->integral_coefficients, carl::getNum(x), carl::getDenom(x));
+	}
+
+	/**
+	 * Returns a dyadic rational m / 2^e within the interior of the interval, close to its center.
+	 * Once the interval endpoints are dyadic, this is the center itself,
+	 * hence refinement keeps the endpoints dyadic and their denominators grow by a single bit per step.
+	 * Integers are preferred (as by carl::sample()) such that integral roots are eventually hit exactly.
+	 */
+	Number dyadic_pivot() const {
+		if (interval_int().containsInteger()) return carl::sample(interval_int(), false);
+		Number width = interval_int().diameter();
+		// Choose e such that 2^-e <= width / 2, then m = floor(center * 2^e) is within the interval.
+		long bits = long(carl::bitsize(carl::getDenom(width))) - long(carl::bitsize(carl::getNum(width))) + 2;
+		std::size_t exponent = bits > 0 ? std::size_t(bits) : 0;
+		Number scale(carl::constant_one<Integer>::get() << exponent);
+		Number pivot = carl::floor(carl::center(interval_int()) * scale) / scale;
+		assert(interval_int().contains(pivot) && pivot != interval_int().lower());
+		return pivot;
+	}
+
+	/**
+	 * Returns an enclosure of the number by a double interval, if the number is within the range of doubles.
+	 * The isolating interval is rounded outwards and then bisected at doubles
+	 * as long as the sign of the polynomial at the midpoint is certain in double interval arithmetic.
+	 * As the number itself never changes, the enclosure is computed only once.
+	 */
+	std::optional<Interval<double>> float_interval() const {
+		if (!m_content->float_interval) {
+			m_content->float_interval = compute_float_interval().value_or(Interval<double>::unboundedInterval());
+		}
+		if (!ran::interval::filter::is_finite(*m_content->float_interval)) return std::nullopt;
+		return m_content->float_interval;
+	}
+
+	std::optional<Interval<double>> compute_float_interval() const {
+		auto res = ran::interval::filter::enclose(interval_int());
+		if (!res || is_numeric()) return res;
+		double lower = res->lower();
+		double upper = res->upper();
+		// Every step gains one bit, hence this suffices for the precision of doubles unless the interval spans several binades.
+		for (std::size_t steps = 0; steps < 64; ++steps) {
+			double mid = lower + (upper - lower) / 2;
+			if (!(lower < mid && mid < upper)) break;
+			Number pivot = carl::rationalize<Number>(mid);
+			bool above;
+			if (pivot <= interval_int().lower()) {
+				above = true;
+			} else if (pivot >= interval_int().upper()) {
+				above = false;
+			} else {
+				auto psgn = ran::interval::filter::sgn(ran::interval::filter::evaluate(polynomial_int(), Interval<double>(mid)));
+				if (!psgn) break;
+				if (*psgn == Sign::ZERO) {
+					lower = upper = mid;
+					break;
+				}
+				above = *psgn == m_content->lower_sign;
+			}
+			if (above) lower = mid;
+			else upper = mid;
+		}
+		return Interval<double>(lower, BoundType::WEAK, upper, BoundType::WEAK);
+	}
+
+	/**
+	 * Performs a single step of quadratic interval refinement @cite Abbott06 .
+	 * The interval is divided into N subintervals and the secant through the endpoints selects the subinterval that should contain the number.
+	 * If it does, N is squared for the next step, otherwise N is reduced to its square root (but at least four).
+	 * In both cases, the interval is refined to the probed subdivision points.
+	 * As N is a power of two, dyadic endpoints stay dyadic.
+	 * @return If the interval was shrunk by a factor of N.
+	 */
+	bool refine_quadratic() const {
+		assert(!is_numeric());
+		Number lower = interval_int().lower();
+		Number upper = interval_int().upper();
+		Number lower_value = carl::evaluate(polynomial_int(), lower);
+		Number upper_value = carl::evaluate(polynomial_int(), upper);
+		Integer n = carl::constant_one<Integer>::get() << m_content->qir_exponent;
+		Number width = (upper - lower) / Number(n);
+		// Index of the subdivision point closest to the secant root, the number is expected within one subinterval around it.
+		Integer index = carl::round(Number(n) * lower_value / (lower_value - upper_value));
+		index = std::max(carl::constant_one<Integer>::get(), std::min(index, Integer(n - 1)));
+		Number pivot = lower + Number(index) * width;
+
+		bool success;
+		Sign s = refine_internal(pivot);
+		if (s == Sign::ZERO) {
+			success = true;
+		} else if (s == Sign::POSITIVE) {
+			success = index + 1 == n || refine_internal(pivot + width) != Sign::POSITIVE;
+		} else {
+			success = index == 1 || refine_internal(pivot - width) != Sign::NEGATIVE;
+		}
+		if (success) {
+			m_content->qir_exponent *= 2;
+		} else {
+			m_content->qir_exponent = std::max(std::size_t(2), m_content->qir_exponent / 2);
+		}
+		CARL_LOG_TRACE("carl.ran.ir", "Quadratic refinement step with " << n << " subintervals " << (success ? "succeeded" : "failed") << ": " << interval_int());
+		return success;
+	}
+
 public: // TODO should be private
 	void refine() const {
 		if (is_numeric()) return;
-		Number pivot = carl::sample(interval_int());
-		refine_internal(pivot);
+		refine_internal(dyadic_pivot());
+	}
+
+	/**
+	 * Refines the isolating interval until its width is at most 2^-bits.
+	 * Uses quadratic interval refinement, which doubles the number of correct bits per step once the interval is small enough,
+	 * and falls back to bisection whenever a step fails.
+	 */
+	void refine_to_precision(std::size_t bits) const {
+		Number precision = Number(1) / Number(carl::constant_one<Integer>::get() << bits);
+		while (!is_numeric() && interval_int().diameter() > precision) {
+			if (!refine_quadratic()) refine();
+		}
 	}
 
 private:
@@ -186,12 +350,20 @@ public:
 	real_algebraic_number_interval(const Number& n)
 		: m_content(std::make_shared<content>(Interval<Number>(n))) {}
 
-	real_algebraic_number_interval(const Polynomial& p, const Interval<Number>& i)
+	/**
+	 * Creates the unique root of p within i.
+	 * @param p Square-free polynomial.
+	 * @param i Open isolating interval or point interval.
+	 * @param root_counting Root counting data for p if available, for example shared with other roots of p.
+	 */
+	real_algebraic_number_interval(const Polynomial& p, const Interval<Number>& i, std::shared_ptr<const ran::interval::RootCountingData<Number>> root_counting = nullptr)
 		: m_content(std::make_shared<content>(replaceVariable(p), i)) {
 		CARL_LOG_DEBUG("carl.ran.ir", "Creating (" << p << "," << i << ")");
+		assert(!root_counting || root_counting->polynomial() == p);
+		m_content->root_counting = std::move(root_counting);
 		assert(!carl::isZero(polynomial_int()) && polynomial_int().degree() > 0);
 		assert(interval_int().isOpenInterval() || interval_int().isPointInterval());
-		// assert(interval_int().isPointInterval() || count_real_roots(sturm_sequence(), interval_int()) == 1);
+		// assert(interval_int().isPointInterval() || root_counting()->count_real_roots(interval_int()) == 1);
 		if (interval_int().isPointInterval()) {
 			m_content->simplify_to_point();
 		} else if (polynomial_int().degree() == 1) {
@@ -200,7 +372,7 @@ public:
 			interval_int() = Interval<Number>(Number(-b / a));
 			m_content->simplify_to_point();
 		} else {
-			m_content->lower_sign = carl::sgn(carl::evaluate(polynomial_int(), interval_int().lower()));
+			m_content->lower_sign = sgn_at(interval_int().lower());
 			if (interval_int().contains(0)) refine_using(0);
 			refine_to_integrality();
 		}
@@ -239,6 +411,15 @@ public:
 		return m_content->interval;
 	}
 
+	/// Returns the root counting data for the polynomial, create it if necessary.
+	const auto& root_counting() const {
+		assert(!is_numeric());
+		if (!m_content->root_counting) {
+			m_content->root_counting = std::make_shared<const ran::interval::RootCountingData<Number>>(polynomial_int());
+		}
+		return m_content->root_counting;
+	}
+
 	const auto& value() const {
 		assert(is_numeric());
 		return interval_int().lower();
@@ -280,6 +461,13 @@ public:
 	Sign sgn(const Polynomial& p) const {
 		Polynomial tmp = replaceVariable(p);
 		if (polynomial_int() == tmp) return Sign::ZERO;
+		auto enclosure = float_interval();
+		auto filtered = enclosure ? ran::interval::filter::sgn(ran::interval::filter::evaluate(p, *enclosure)) : std::nullopt;
+		CARL_CALL_STATISTICS(ran::interval::filter::statistics().sgn(filtered.has_value()));
+		if (filtered) {
+			CARL_LOG_TRACE("carl.ran", "Sign of " << p << " obtained by floating-point filter");
+			return *filtered;
+		}
 		auto seq = carl::sturm_sequence(polynomial_int(), derivative(polynomial_int()) * tmp);
 		int variations = carl::count_real_roots(seq, interval_int());
 		assert((variations == -1) || (variations == 0) || (variations == 1));
@@ -384,6 +572,14 @@ bool compare(const real_algebraic_number_interval<Number>& lhs, const real_algeb
 
 	if (carl::set_have_intersection(lhs.interval_int(), rhs.interval_int())) {
 		CARL_LOG_TRACE("carl.ran", "Intervals " << lhs.interval_int() << " and " << rhs.interval_int() << " do intersect");
+		auto lf = lhs.float_interval();
+		auto rf = rhs.float_interval();
+		bool filtered = lf && rf && !carl::set_have_intersection(*lf, *rf);
+		CARL_CALL_STATISTICS(ran::interval::filter::statistics().compare(filtered));
+		if (filtered) {
+			CARL_LOG_TRACE("carl.ran", "Floating-point enclosures " << *lf << " and " << *rf << " are disjoint");
+			return evaluate(lf->upper() < rf->lower() ? Sign::NEGATIVE : Sign::POSITIVE, relation);
+		}
 		auto intersection = carl::set_intersection(lhs.interval_int(), rhs.interval_int());
 		assert(!intersection.isEmpty());
 		lhs.refine_using(intersection.lower());
@@ -428,10 +624,10 @@ bool compare(const real_algebraic_number_interval<Number>& lhs, const real_algeb
 	CARL_LOG_TRACE("carl.ran", "Intervals " << lhs.interval_int() << " and " << rhs.interval_int() << " are disjoint");
 	assert(!carl::set_have_intersection(lhs.interval_int(), rhs.interval_int()));
 	if (lhs.interval_int().upper() <= rhs.interval_int().lower()) {
-		return relation == Relation::LESS || relation == Relation::LEQ;
+		return evaluate(Sign::NEGATIVE, relation);
 	}
 	if (lhs.interval_int().lower() >= rhs.interval_int().upper()) {
-		return relation == Relation::GREATER || relation == Relation::GEQ;
+		return evaluate(Sign::POSITIVE, relation);
 	}
 
 	assert(false);
@@ -440,6 +636,15 @@ bool compare(const real_algebraic_number_interval<Number>& lhs, const real_algeb
 
 template<typename Number>
 bool compare(const real_algebraic_number_interval<Number>& lhs, const Number& rhs, const Relation relation) {
+	if (!lhs.is_numeric() && lhs.interval_int().contains(rhs)) {
+		auto lf = lhs.float_interval();
+		auto rf = ran::interval::filter::enclose(rhs);
+		bool filtered = lf && rf && !carl::set_have_intersection(*lf, *rf);
+		CARL_CALL_STATISTICS(ran::interval::filter::statistics().compare_number(filtered));
+		if (filtered) {
+			return evaluate(lf->upper() < rf->lower() ? Sign::NEGATIVE : Sign::POSITIVE, relation);
+		}
+	}
 	auto res = lhs.refine_using(rhs);
 	if (res) {
 		return evaluate(*res, relation);
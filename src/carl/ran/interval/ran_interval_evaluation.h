@@ -7,11 +7,58 @@
 
 #include "ran_interval.h"
 #include "AlgebraicSubstitution.h"
+#include "AssignmentPrefixCache.h"
 
 #include <boost/logic/tribool_io.hpp>
 
 namespace carl {
 
+/**
+ * Computes the square-free part of the algebraic substitution of m into v - p, where v is a fresh variable.
+ * Its real roots include the value of p on m.
+ * If only a single real algebraic number remains in p, the result is cached within this number
+ * and repeated evaluations of p reuse the result including its root counting data.
+ * Each number only keeps the results for the few polynomials it was most recently substituted into.
+ * Results depending on several real algebraic numbers are not cached, as they depend on the whole assignment.
+ * @param p Polynomial whose remaining variables are assigned to the non-numeric numbers in m.
+ * @param m Variable assignment.
+ * @param var_to_interval The isolating intervals of the variables of p.
+ * @return The result or nullptr if the algebraic substitution failed.
+ */
+template<typename Number>
+std::shared_ptr<const ran::interval::RootCountingData<Number>> evaluation_polynomial(const MultivariatePolynomial<Number>& p, const ran::ran_assignment_t<real_algebraic_number_interval<Number>>& m, const std::map<Variable, Interval<Number>>& var_to_interval) {
+	typename real_algebraic_number_interval<Number>::content* cache = nullptr;
+	if (var_to_interval.size() == 1) {
+		cache = m.at(var_to_interval.begin()->first).m_content.get();
+		if (auto res = cache->find_substitution(p)) {
+			CARL_LOG_TRACE("carl.ran.evaluation", "Reuse result polynomial " << res->polynomial());
+			return res;
+		}
+	}
+
+	Variable v = freshRealVariable();
+	std::vector<UnivariatePolynomial<MultivariatePolynomial<Number>>> algebraic_information;
+	for (const auto& [var, ran] : m) {
+		if (var_to_interval.find(var) == var_to_interval.end()) continue;
+		assert(!ran.is_numeric());
+		algebraic_information.emplace_back(replace_main_variable(ran.polynomial_int(), var).template convert<MultivariatePolynomial<Number>>());
+	}
+	// substitute RANs with low degrees first
+	std::sort(algebraic_information.begin(), algebraic_information.end(), [](const auto& a, const auto& b){ 
+		return a.degree() > b.degree();
+	});
+	auto res = ran::interval::algebraic_substitution(UnivariatePolynomial<MultivariatePolynomial<Number>>(v, {MultivariatePolynomial<Number>(-p), MultivariatePolynomial<Number>(1)}), algebraic_information);
+	if (!res) {
+		return nullptr;
+	}
+	// Note that res cannot be zero as v is a fresh variable in v-p.
+	auto result = std::make_shared<const ran::interval::RootCountingData<Number>>(carl::squareFreePart(*res));
+	if (cache) {
+		cache->add_substitution(p, result);
+	}
+	return result;
+}
+
 /**
  * Evaluate the given polynomial with the given values for the variables.
  * Asserts that all variables of p have an assignment in m and that m has no additional assignments.
@@ -20,21 +67,22 @@ namespace carl {
  *
  * @param p Polynomial to be evaluated
  * @param m Variable assignment
+ * @param cache Cache for the algebraic substitution, its assignment must be m.
  * @return Evaluation result
  */
 template<typename Number>
-std::optional<real_algebraic_number_interval<Number>> evaluate(MultivariatePolynomial<Number> p, const ran::ran_assignment_t<real_algebraic_number_interval<Number>>& m, bool refine_model = true) {
+std::optional<real_algebraic_number_interval<Number>> evaluate(MultivariatePolynomial<Number> p, const ran::ran_assignment_t<real_algebraic_number_interval<Number>>& m, bool refine_model = true, ran::interval::AssignmentPrefixCache<Number>* cache = nullptr) {
 	CARL_LOG_DEBUG("carl.ran.evaluation", "Evaluating " << p << " on " << m);
+	// The cache knows the substitutions into the original polynomial.
+	std::optional<MultivariatePolynomial<Number>> original;
+	if (cache) original = p;
 	
 	CARL_LOG_TRACE("carl.ran.evaluation", "Substitute rationals");
 	for (const auto& [var, ran] : m) {
 		if (!p.has(var)) continue;
 		if (refine_model) {
 			CARL_LOG_TRACE("carl.ran.evaluation", "Refine " << var << " = " << ran);
-			static Number min_width = Number(1) / (Number(1048576)); // 1/2^20, taken from libpoly
-			while (!ran.is_numeric() && ran.interval().diameter() > min_width) {
-				ran.refine();
-			}
+			ran.refine_to_precision(20); // 1/2^20, taken from libpoly
 		}
 		if (ran.is_numeric()) {
 			CARL_LOG_TRACE("carl.ran.evaluation", "Substitute " << var << " = " << ran);
@@ -79,36 +127,22 @@ std::optional<real_algebraic_number_interval<Number>> evaluate(MultivariatePolyn
 	}
 
 	CARL_LOG_TRACE("carl.ran.evaluation", "Compute result polynomial");
-	Variable v = freshRealVariable();
-	std::vector<UnivariatePolynomial<MultivariatePolynomial<Number>>> algebraic_information;
-	for (const auto& [var, ran] : m) {
-		if (var_to_interval.find(var) == var_to_interval.end()) continue;
-		assert(!ran.is_numeric());
-		algebraic_information.emplace_back(replace_main_variable(ran.polynomial_int(), var).template convert<MultivariatePolynomial<Number>>());
-	}
-	// substitute RANs with low degrees first
-	std::sort(algebraic_information.begin(), algebraic_information.end(), [](const auto& a, const auto& b){ 
-		return a.degree() > b.degree();
-	});
-	auto res = ran::interval::algebraic_substitution(UnivariatePolynomial<MultivariatePolynomial<Number>>(v, {MultivariatePolynomial<Number>(-p), MultivariatePolynomial<Number>(1)}), algebraic_information);
-	if (!res) {
+	auto result = cache ? cache->evaluation_polynomial(*original) : evaluation_polynomial(p, m, var_to_interval);
+	if (!result) {
 		return std::nullopt;
 	}
-	res = carl::squareFreePart(*res);
-	// Note that res cannot be zero as v is a fresh variable in v-p.
+	const auto& res = result->polynomial();
 
-	CARL_LOG_TRACE("carl.ran.evaluation", "res = " << *res);
+	CARL_LOG_TRACE("carl.ran.evaluation", "res = " << res);
 	CARL_LOG_TRACE("carl.ran.evaluation", "var_to_interval = " << var_to_interval);
 	CARL_LOG_TRACE("carl.ran.evaluation", "p = " << p);
 	CARL_LOG_TRACE("carl.ran.evaluation", "-> " << interval);
 
-	CARL_LOG_TRACE("carl.ran.evaluation", "Compute sturm sequence");
-	auto sturm_seq = sturm_sequence(*res);
 	// the interval should include at least one root.
 	CARL_LOG_TRACE("carl.ran.evaluation", "Refine intervals");
-	assert(!carl::isZero(*res));
-	assert(carl::is_root_of(*res, interval.lower()) || carl::is_root_of(*res, interval.upper()) || count_real_roots(sturm_seq, interval) >= 1);
-	while (!interval.isPointInterval() && (carl::is_root_of(*res, interval.lower()) || carl::is_root_of(*res, interval.upper()) || count_real_roots(sturm_seq, interval) != 1)) {
+	assert(!carl::isZero(res));
+	assert(carl::is_root_of(res, interval.lower()) || carl::is_root_of(res, interval.upper()) || result->count_real_roots(interval) >= 1);
+	while (!interval.isPointInterval() && (carl::is_root_of(res, interval.lower()) || carl::is_root_of(res, interval.upper()) || result->count_real_roots(interval) != 1)) {
 		CARL_LOG_TRACE("carl.ran.evaluation", "Refinement step");
 		// refine the result interval until it isolates exactly one real root of the result polynomial
 		for (const auto& [var, ran] : m) {
@@ -126,21 +160,47 @@ std::optional<real_algebraic_number_interval<Number>> evaluate(MultivariatePolyn
 		CARL_LOG_TRACE("carl.ran.evaluation", "Interval evaluation");
 		interval = IntervalEvaluation::evaluate(p, var_to_interval);
 	}
-	CARL_LOG_DEBUG("carl.ran.evaluation", "Result is " << *res << " " << interval);
+	CARL_LOG_DEBUG("carl.ran.evaluation", "Result is " << res << " " << interval);
 	if (interval.isPointInterval()) {
 		return real_algebraic_number_interval<Number>(interval.lower());
 	} else {
-		return real_algebraic_number_interval<Number>(*res, interval);
+		return real_algebraic_number_interval<Number>(res, interval, result);
 	}
 }
 
+/**
+ * Evaluate the given constraint with the given values for the variables.
+ * If a cache is given, the sign of the left hand side is determined by evaluating it on the cache,
+ * after interval evaluation was inconclusive.
+ * @param c Constraint to be evaluated
+ * @param m Variable assignment
+ * @param cache Cache for the algebraic substitution, its assignment must be m.
+ * @return Evaluation result or indeterminate if the algebraic substitution failed
+ */
 template<typename Number, typename Poly>
-boost::tribool evaluate(const Constraint<Poly>& c, const ran::ran_assignment_t<real_algebraic_number_interval<Number>>& m, bool refine_model = true, bool use_root_bounds = true) {
+boost::tribool evaluate(const Constraint<Poly>& c, const ran::ran_assignment_t<real_algebraic_number_interval<Number>>& m, bool refine_model = true, bool use_root_bounds = true, ran::interval::AssignmentPrefixCache<Number>* cache = nullptr) {
 	CARL_LOG_DEBUG("carl.ran.evaluation", "Evaluating " << c << " on " << m);
-	
+
+	{
+		std::map<Variable, Interval<double>> var_to_float_interval;
+		for (const auto& [var, ran] : m) {
+			if (!c.lhs().has(var)) continue;
+			auto enclosure = ran.float_interval();
+			if (!enclosure) break;
+			var_to_float_interval.emplace(var, *enclosure);
+		}
+		auto interval = ran::interval::filter::evaluate(c.lhs(), var_to_float_interval);
+		boost::tribool res = interval ? carl::evaluate(*interval, c.relation()) : boost::indeterminate;
+		CARL_CALL_STATISTICS(ran::interval::filter::statistics().constraint(!indeterminate(res)));
+		if (!indeterminate(res)) {
+			CARL_LOG_DEBUG("carl.ran.evaluation", "Result obtained by floating-point filter on " << *interval);
+			return res;
+		}
+	}
+
 	if (!use_root_bounds) {
 		CARL_LOG_DEBUG("carl.ran.evaluation", "Evaluate constraint by evaluating poly");
-		auto res = evaluate(c.lhs(), m);
+		auto res = evaluate(c.lhs(), m, true, cache);
 		if (!res) return boost::indeterminate;
 		else return evaluate(res->sgn(), c.relation());
 	} else {
@@ -151,10 +211,7 @@ boost::tribool evaluate(const Constraint<Poly>& c, const ran::ran_assignment_t<r
 		for (const auto& [var, ran] : m) {
 			if (!p.has(var)) continue;
 			if (refine_model) {
-				static Number min_width = Number(1) / (Number(1048576)); // 1/2^20, taken from libpoly
-				while (!ran.is_numeric() && ran.interval().diameter() > min_width) {
-					ran.refine();
-				}
+				ran.refine_to_precision(20); // 1/2^20, taken from libpoly
 			}
 			if (ran.is_numeric()) {
 				substitute_inplace(p, var, MultivariatePolynomial<Number>(ran.value()));
@@ -193,6 +250,13 @@ boost::tribool evaluate(const Constraint<Poly>& c, const ran::ran_assignment_t<r
 			}
 		}
 
+		if (cache) {
+			CARL_LOG_DEBUG("carl.ran.evaluation", "Evaluate constraint by evaluating poly on cache");
+			auto res = evaluate(MultivariatePolynomial<Number>(c.lhs()), m, false, cache);
+			if (!res) return boost::indeterminate;
+			else return evaluate(res->sgn(), c.relation());
+		}
+
 		CARL_LOG_DEBUG("carl.ran.evaluation", "Evaluate constraint using resultants and root bounds");
 		assert(var_to_interval.size() > 0);
 		if (var_to_interval.size() == 1) {
@@ -206,25 +270,14 @@ boost::tribool evaluate(const Constraint<Poly>& c, const ran::ran_assignment_t<r
 			}
 		}
 
-		// compute the result polynomial	
-		Variable v = freshRealVariable();
-		std::vector<UnivariatePolynomial<MultivariatePolynomial<Number>>> algebraic_information;
-		for (const auto& [var, ran] : m) {
-			if (var_to_interval.find(var) == var_to_interval.end()) continue;
-			assert(!ran.is_numeric());
-			algebraic_information.emplace_back(replace_main_variable(ran.polynomial_int(), var).template convert<MultivariatePolynomial<Number>>());
-		}
-		// substitute RANs with low degrees first
-		std::sort(algebraic_information.begin(), algebraic_information.end(), [](const auto& a, const auto& b){ 
-			return a.degree() > b.degree();
-		});
-		auto res = ran::interval::algebraic_substitution(UnivariatePolynomial<MultivariatePolynomial<Number>>(v, {MultivariatePolynomial<Number>(-p), MultivariatePolynomial<Number>(1)}), algebraic_information);
-		// Note that res cannot be zero as v is a fresh variable in v-p.
-		if (!res) {
+		// compute the result polynomial
+		auto result = evaluation_polynomial(MultivariatePolynomial<Number>(p), m, var_to_interval);
+		if (!result) {
 			return boost::indeterminate;
 		}
+		const auto& res = result->polynomial();
 
-		CARL_LOG_DEBUG("carl.ran.evaluation", "res = " << *res);
+		CARL_LOG_DEBUG("carl.ran.evaluation", "res = " << res);
 		CARL_LOG_DEBUG("carl.ran.evaluation", "var_to_interval = " << var_to_interval);
 		CARL_LOG_DEBUG("carl.ran.evaluation", "p = " << p);
 		CARL_LOG_DEBUG("carl.ran.evaluation", "-> " << interval);
@@ -233,7 +286,7 @@ boost::tribool evaluate(const Constraint<Poly>& c, const ran::ran_assignment_t<r
 		// Then if the zero of res is in the interval (neg_ub,pos_lb), then it must be zero.
 
 		// compute root bounds
-		auto pos_lb = lagrangePositiveLowerBound(*res);
+		auto pos_lb = lagrangePositiveLowerBound(res);
 		CARL_LOG_TRACE("carl.ran.evaluation", "positive root lower bound: " << pos_lb);
 		if (pos_lb == 0) {
 			// no positive root exists
@@ -244,7 +297,7 @@ boost::tribool evaluate(const Constraint<Poly>& c, const ran::ran_assignment_t<r
 				return true;
 			}
 		}
-		auto neg_ub = lagrangeNegativeUpperBound(*res);
+		auto neg_ub = lagrangeNegativeUpperBound(res);
 		CARL_LOG_TRACE("carl.ran.evaluation", "negative root upper bound: " << neg_ub);
 		if (neg_ub == 0) {
 			// no negative root exists
@@ -262,7 +315,7 @@ boost::tribool evaluate(const Constraint<Poly>& c, const ran::ran_assignment_t<r
 			return evaluate(Sign::ZERO, constr.relation());
 		}
 
-		assert(!carl::isZero(*res));
+		assert(!carl::isZero(res));
 
 		// refine the interval until it is either positive or negative or is contained in (neg_ub,pos_lb)
 		CARL_LOG_DEBUG("carl.ran.evaluation", "Refine until interval is in (" << neg_ub << "," << pos_lb << ") or interval is positive or negative");
@@ -292,4 +345,22 @@ boost::tribool evaluate(const Constraint<Poly>& c, const ran::ran_assignment_t<r
 	}
 }
 
+/**
+ * Evaluate the given polynomial on the assignment of the given cache.
+ * The algebraic substitution reuses the work done for the longest prefix of the assignment that was used before.
+ */
+template<typename Number>
+std::optional<real_algebraic_number_interval<Number>> evaluate(const MultivariatePolynomial<Number>& p, ran::interval::AssignmentPrefixCache<Number>& cache, bool refine_model = true) {
+	return evaluate(p, cache.model(), refine_model, &cache);
+}
+
+/**
+ * Evaluate the given constraint on the assignment of the given cache.
+ * The algebraic substitution reuses the work done for the longest prefix of the assignment that was used before.
+ */
+template<typename Number, typename Poly>
+boost::tribool evaluate(const Constraint<Poly>& c, ran::interval::AssignmentPrefixCache<Number>& cache, bool refine_model = true, bool use_root_bounds = true) {
+	return evaluate(c, cache.model(), refine_model, use_root_bounds, &cache);
+}
+
 }
@@ -167,7 +167,8 @@ public:
 
 		assert(carl::variables(m_poly).size() == 1 && m_poly.has(m_var));
 
-		UnivariatePolynomial<Number> res = carl::squareFreePart(m_poly.toNumberCoefficients());
+		auto result = std::make_shared<const ran::interval::RootCountingData<Number>>(carl::squareFreePart(m_poly.toNumberCoefficients()));
+		const auto& res = result->polynomial();
 
 		CARL_LOG_TRACE("carl.ran", "Computing value of " << m_original_poly << " at " << m_ir_assignments << " using " << res);
 
@@ -184,11 +185,10 @@ public:
 			return real_algebraic_number_interval<Number>(interval.lower());
 		}
 
-		auto sturm_seq = sturm_sequence(res);
 		// the interval should include at least one root.
 		assert(!carl::isZero(res));
-		assert(carl::is_root_of(res, interval.lower()) || carl::is_root_of(res, interval.upper()) || count_real_roots(sturm_seq, interval) >= 1);
-		while (!interval.isPointInterval() && (carl::is_root_of(res, interval.lower()) || carl::is_root_of(res, interval.upper()) || count_real_roots(sturm_seq, interval) != 1)) {
+		assert(carl::is_root_of(res, interval.lower()) || carl::is_root_of(res, interval.upper()) || result->count_real_roots(interval) >= 1);
+		while (!interval.isPointInterval() && (carl::is_root_of(res, interval.lower()) || carl::is_root_of(res, interval.upper()) || result->count_real_roots(interval) != 1)) {
 			// refine the result interval until it isolates exactly one real root of the result polynomial
 			for (const auto& [var, ran] : m_ir_assignments) {
 				if (var_to_interval.find(var) == var_to_interval.end()) continue;
@@ -207,7 +207,7 @@ public:
 		if (interval.isPointInterval()) {
 			return real_algebraic_number_interval<Number>(interval.lower());
 		} else {
-			return real_algebraic_number_interval<Number>(res, interval);
+			return real_algebraic_number_interval<Number>(res, interval, result);
 		}
 	}
 };
@@ -5,29 +5,37 @@
 #include <carl/core/logging.h>
 #include <carl/core/Sign.h>
 #include <carl/core/UnivariatePolynomial.h>
+#include <carl/core/polynomialfunctions/CoprimePart.h>
 
+#include "AssignmentPrefixCache.h"
 #include "RealRootIsolation.h"
 
 #include "../real_roots_common.h"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <map>
+#include <thread>
 
 namespace carl::ran::interval {
 
 /**
  * Find all real roots of a univariate 'polynomial' with numeric coefficients within a given 'interval'.
  * The roots are sorted in ascending order.
+ * The roots are isolated by the given 'method'.
  */
 template<typename Coeff, typename Number = typename UnderlyingNumberType<Coeff>::type, EnableIf<std::is_same<Coeff, Number>> = dummy>
 real_roots_result<real_algebraic_number_interval<Number>> real_roots(
 		const UnivariatePolynomial<Coeff>& polynomial,
-		const Interval<Number>& interval = Interval<Number>::unboundedInterval()
+		const Interval<Number>& interval = Interval<Number>::unboundedInterval(),
+		RootIsolationMethod method = RootIsolationMethod::BISECTION
 ) {
 	if (carl::isZero(polynomial)) {
 		return real_roots_result<real_algebraic_number_interval<Number>>::nullified_response();
 	}
 	CARL_LOG_DEBUG("carl.ran.realroots", polynomial << " within " << interval);
-	carl::ran::interval::RealRootIsolation rri(polynomial, interval);
+	carl::ran::interval::RealRootIsolation rri(polynomial, interval, method);
 	auto r = rri.get_roots();
 	CARL_LOG_DEBUG("carl.ran.realroots", "-> " << r);
 	return real_roots_result<real_algebraic_number_interval<Number>>::roots_response(std::move(r));
@@ -42,10 +50,11 @@ real_roots_result<real_algebraic_number_interval<Number>> real_roots(
 template<typename Coeff, typename Number = typename UnderlyingNumberType<Coeff>::type, DisableIf<std::is_same<Coeff, Number>> = dummy>
 real_roots_result<real_algebraic_number_interval<Number>> real_roots(
 		const UnivariatePolynomial<Coeff>& polynomial,
-		const Interval<Number>& interval = Interval<Number>::unboundedInterval()
+		const Interval<Number>& interval = Interval<Number>::unboundedInterval(),
+		RootIsolationMethod method = RootIsolationMethod::BISECTION
 ) {
 	assert(polynomial.isUnivariate());
-	return real_roots(polynomial.convert(std::function<Number(const Coeff&)>([](const Coeff& c){ return c.constantPart(); })), interval);
+	return real_roots(polynomial.convert(std::function<Number(const Coeff&)>([](const Coeff& c){ return c.constantPart(); })), interval, method);
 }
 
 /**
@@ -67,7 +76,8 @@ template<typename Coeff, typename Number>
 real_roots_result<real_algebraic_number_interval<Number>> real_roots(
 		const UnivariatePolynomial<Coeff>& poly,
 		const ran::ran_assignment_t<real_algebraic_number_interval<Number>>& varToRANMap,
-		const Interval<Number>& interval = Interval<Number>::unboundedInterval()
+		const Interval<Number>& interval = Interval<Number>::unboundedInterval(),
+		RootIsolationMethod method = RootIsolationMethod::BISECTION
 ) {
 	CARL_LOG_FUNC("carl.ran.realroots", poly << " in " << poly.mainVar() << ", " << varToRANMap << ", " << interval);
 	assert(varToRANMap.count(poly.mainVar()) == 0);
@@ -105,7 +115,7 @@ real_roots_result<real_algebraic_number_interval<Number>> real_roots(
 	if (ir_map.empty()) {
 		assert(polyCopy.isUnivariate());
 		CARL_LOG_TRACE("carl.ran.realroots", "poly " << polyCopy << " is univariate after substituting rational assignments");
-		return real_roots(polyCopy, interval);
+		return real_roots(polyCopy, interval, method);
 	} else {
 		CARL_LOG_TRACE("carl.ran.realroots", polyCopy << " in " << polyCopy.mainVar() << ", " << varToRANMap << ", " << interval);
 		assert(ir_map.find(polyCopy.mainVar()) == ir_map.end());
@@ -130,7 +140,7 @@ real_roots_result<real_algebraic_number_interval<Number>> real_roots(
 		CARL_LOG_TRACE("carl.ran.realroots", "Calling on " << *evaledpoly);
 		Constraint<MultivariatePolynomial<Number>> cons(MultivariatePolynomial<Number>(polyCopy), Relation::EQ);
 		std::vector<real_algebraic_number_interval<Number>> roots;
-		auto res = real_roots(*evaledpoly, interval);
+		auto res = real_roots(*evaledpoly, interval, method);
 		for (const auto& r: res.roots()) { // TODO can be made more efficient!
 			CARL_LOG_TRACE("carl.ran.realroots", "Checking " << polyCopy.mainVar() << " = " << r);
 			ir_map[polyCopy.mainVar()] = r;
@@ -145,4 +155,206 @@ real_roots_result<real_algebraic_number_interval<Number>> real_roots(
 	}
 }
 
-}
\ No newline at end of file
+/**
+ * Find all real roots of the univariate polynomial 'p' after replacing all other variables by the numbers assigned by 'cache'.
+ * The requirements on 'p' are the same as for real_roots() with an assignment.
+ * The substitution reuses the work done for the longest prefix of the assignment that was used before,
+ * which makes lifting sample points that differ in the last coordinate only cheap.
+ * If a resultant vanishes identically (as the defining polynomials are not minimal within the tower of field extensions),
+ * this falls back to real_roots() with an assignment.
+ * The roots are sorted in ascending order.
+ */
+template<typename Number>
+real_roots_result<real_algebraic_number_interval<Number>> real_roots(
+		const UnivariatePolynomial<MultivariatePolynomial<Number>>& p,
+		AssignmentPrefixCache<Number>& cache,
+		const Interval<Number>& interval = Interval<Number>::unboundedInterval(),
+		RootIsolationMethod method = RootIsolationMethod::BISECTION
+) {
+	CARL_LOG_FUNC("carl.ran.realroots", p << " in " << p.mainVar() << ", " << cache.model() << ", " << interval);
+	assert(cache.model().count(p.mainVar()) == 0);
+	if (carl::isZero(p)) {
+		return real_roots_result<real_algebraic_number_interval<Number>>::nullified_response();
+	}
+	const auto& res = cache.substitute(p);
+	if (!res.isUnivariate()) {
+		CARL_LOG_TRACE("carl.ran.realroots", "poly still contains unassigned variable -> non-univariate");
+		return real_roots_result<real_algebraic_number_interval<Number>>::non_univariate_response();
+	}
+	bool algebraic = cache.has_algebraic_level(p);
+	if (carl::isZero(res)) {
+		if (algebraic) {
+			CARL_LOG_DEBUG("carl.ran.realroots", "Resultant vanished, fall back to field extensions");
+			return real_roots(p, cache.model(), interval, method);
+		}
+		CARL_LOG_TRACE("carl.ran.realroots", "poly is 0 after substituting rational assignments -> nullified");
+		return real_roots_result<real_algebraic_number_interval<Number>>::nullified_response();
+	}
+	auto roots = real_roots(res.toNumberCoefficients(), interval, method);
+	if (!algebraic) {
+		return roots;
+	}
+	// The resultants may have introduced additional roots.
+	Constraint<MultivariatePolynomial<Number>> cons(MultivariatePolynomial<Number>(p), Relation::EQ);
+	auto model = cache.model();
+	std::vector<real_algebraic_number_interval<Number>> result;
+	for (const auto& r: roots.roots()) {
+		model[p.mainVar()] = r;
+		if (evaluate(cons, model)) {
+			result.emplace_back(r);
+		} else {
+			CARL_LOG_TRACE("carl.ran.realroots", "Purging spurious root " << r);
+		}
+	}
+	return real_roots_result<real_algebraic_number_interval<Number>>::roots_response(std::move(result));
+}
+
+namespace detail_batch_real_roots {
+
+/// Sorts the roots and merges the origins of equal roots.
+template<typename Number>
+void sort_and_merge(std::vector<std::pair<real_algebraic_number_interval<Number>, std::vector<std::size_t>>>& roots) {
+	std::sort(roots.begin(), roots.end(), [](const auto& a, const auto& b){ return a.first < b.first; });
+	auto out = roots.begin();
+	for (auto it = roots.begin(); it != roots.end(); ++it) {
+		if (out != roots.begin() && std::prev(out)->first == it->first) {
+			auto& origins = std::prev(out)->second;
+			origins.insert(origins.end(), it->second.begin(), it->second.end());
+			std::sort(origins.begin(), origins.end());
+			origins.erase(std::unique(origins.begin(), origins.end()), origins.end());
+		} else {
+			if (out != it) *out = std::move(*it);
+			++out;
+		}
+	}
+	roots.erase(out, roots.end());
+}
+
+}
+
+/**
+ * Find all real roots of several univariate 'polynomials' with numeric coefficients within a given 'interval'.
+ *
+ * Instead of isolating the roots of every polynomial on its own, a coprime basis of their square-free parts is computed first (see coprime_basis()),
+ * such that common factors are handled only once and every root is a root of exactly one basis element.
+ * The roots of the basis elements are isolated in parallel by up to 'threads' threads (zero means one per hardware thread).
+ * The result contains every root once in ascending order, together with the indices of the polynomials it is a root of.
+ */
+template<typename Number>
+batch_real_roots_result<real_algebraic_number_interval<Number>> batch_real_roots(
+		const std::vector<UnivariatePolynomial<Number>>& polynomials,
+		const Interval<Number>& interval = Interval<Number>::unboundedInterval(),
+		RootIsolationMethod method = RootIsolationMethod::BISECTION,
+		std::size_t threads = 0
+) {
+	batch_real_roots_result<real_algebraic_number_interval<Number>> result;
+	for (std::size_t i = 0; i < polynomials.size(); ++i) {
+		if (carl::isZero(polynomials[i])) result.nullified.push_back(i);
+	}
+	auto basis = carl::coprime_basis(polynomials);
+	CARL_LOG_DEBUG("carl.ran.realroots", "Isolating roots of " << polynomials.size() << " polynomials using a basis of size " << basis.size());
+
+	std::vector<std::vector<real_algebraic_number_interval<Number>>> roots(basis.size());
+	std::atomic<std::size_t> next(0);
+	std::vector<std::exception_ptr> errors(basis.size());
+	auto worker = [&]() {
+		for (std::size_t k = next++; k < basis.size(); k = next++) {
+			try {
+				RealRootIsolation rri(basis[k].first, interval, method);
+				roots[k] = rri.get_roots();
+			} catch (...) {
+				errors[k] = std::current_exception();
+			}
+		}
+	};
+	if (threads == 0) threads = std::max(std::thread::hardware_concurrency(), 1u);
+	threads = std::min(threads, basis.size());
+	if (threads <= 1) {
+		worker();
+	} else {
+		std::vector<std::thread> pool;
+		for (std::size_t t = 0; t < threads; ++t) pool.emplace_back(worker);
+		for (auto& t: pool) t.join();
+	}
+	for (const auto& e: errors) {
+		if (e) std::rethrow_exception(e);
+	}
+
+	// Roots of distinct basis elements are distinct, hence sorting suffices.
+	for (std::size_t k = 0; k < basis.size(); ++k) {
+		for (auto& r: roots[k]) {
+			result.roots.emplace_back(std::move(r), basis[k].second);
+		}
+	}
+	std::sort(result.roots.begin(), result.roots.end(), [](const auto& a, const auto& b){ return a.first < b.first; });
+	return result;
+}
+
+/**
+ * Find all real roots of several univariate 'polynomials' after replacing all other variables by the numbers in 'varToRANMap',
+ * see real_roots() for the requirements on the polynomials.
+ *
+ * Polynomials that become numeric by substituting rational numbers are handled by batch_real_roots() on numeric polynomials.
+ * The remaining polynomials require algebraic substitutions and are handled one by one.
+ * The result contains every root once in ascending order, together with the indices of the polynomials it is a root of.
+ */
+template<typename Coeff, typename Number, DisableIf<std::is_same<Coeff, Number>> = dummy>
+batch_real_roots_result<real_algebraic_number_interval<Number>> batch_real_roots(
+		const std::vector<UnivariatePolynomial<Coeff>>& polynomials,
+		const ran::ran_assignment_t<real_algebraic_number_interval<Number>>& varToRANMap,
+		const Interval<Number>& interval = Interval<Number>::unboundedInterval(),
+		RootIsolationMethod method = RootIsolationMethod::BISECTION,
+		std::size_t threads = 0
+) {
+	batch_real_roots_result<real_algebraic_number_interval<Number>> result;
+	std::vector<UnivariatePolynomial<Number>> numeric;
+	std::vector<std::size_t> numeric_origins;
+	for (std::size_t i = 0; i < polynomials.size(); ++i) {
+		const auto& poly = polynomials[i];
+		assert(varToRANMap.count(poly.mainVar()) == 0);
+		UnivariatePolynomial<Coeff> polyCopy(poly);
+		bool algebraic = false;
+		bool univariate = true;
+		for (Variable v: carl::variables(poly)) {
+			if (v == poly.mainVar()) continue;
+			auto it = varToRANMap.find(v);
+			if (it == varToRANMap.end()) {
+				univariate = false;
+			} else if (it->second.is_numeric()) {
+				substitute_inplace(polyCopy, v, Coeff(it->second.value()));
+			} else {
+				algebraic = true;
+			}
+		}
+		if (!univariate) {
+			result.non_univariate.push_back(i);
+		} else if (carl::isZero(polyCopy)) {
+			result.nullified.push_back(i);
+		} else if (algebraic) {
+			auto res = real_roots(poly, varToRANMap, interval, method);
+			if (res.is_nullified()) {
+				result.nullified.push_back(i);
+			} else if (res.is_non_univariate()) {
+				result.non_univariate.push_back(i);
+			} else {
+				for (const auto& r: res.roots()) {
+					result.roots.emplace_back(r, std::vector<std::size_t>({i}));
+				}
+			}
+		} else {
+			numeric.emplace_back(polyCopy.convert(std::function<Number(const Coeff&)>([](const Coeff& c){ return c.constantPart(); })));
+			numeric_origins.push_back(i);
+		}
+	}
+	auto res = batch_real_roots(numeric, interval, method, threads);
+	assert(res.nullified.empty() && res.non_univariate.empty());
+	for (auto& [r, origins]: res.roots) {
+		for (auto& o: origins) o = numeric_origins[o];
+		result.roots.emplace_back(std::move(r), std::move(origins));
+	}
+	detail_batch_real_roots::sort_and_merge(result.roots);
+	std::sort(result.nullified.begin(), result.nullified.end());
+	return result;
+}
+
+}
@@ -17,6 +17,8 @@
 namespace carl::ran {
     #ifdef RAN_USE_INTERVAL
     using carl::ran::interval::real_roots;
+    using carl::ran::interval::batch_real_roots;
+    using carl::ran::interval::RootIsolationMethod;
     #endif
 
     #ifdef RAN_USE_THOM
@@ -30,4 +32,7 @@ namespace carl::ran {
 
 namespace carl {
     using carl::ran::real_roots;
+    #ifdef RAN_USE_INTERVAL
+    using carl::ran::batch_real_roots;
+    #endif
 }
\ No newline at end of file
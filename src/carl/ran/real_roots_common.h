@@ -1,5 +1,6 @@
 #pragma once
 
+#include <utility>
 #include <variant>
 // #include <type_traits>
 #include <vector>
@@ -51,4 +52,17 @@ namespace carl::ran {
             return std::get<roots_t>(m_data);
         }
     };
-}
\ No newline at end of file
+
+    /**
+     * Result of isolating the real roots of several polynomials at once.
+     */
+    template<typename RAN>
+    struct batch_real_roots_result {
+        /// The distinct roots in ascending order, each with the (sorted) indices of the polynomials it is a root of.
+        std::vector<std::pair<RAN, std::vector<std::size_t>>> roots;
+        /// Indices of the polynomials that are nullified.
+        std::vector<std::size_t> nullified;
+        /// Indices of the polynomials that are not univariate.
+        std::vector<std::size_t> non_univariate;
+    };
+}
@@ -17,6 +17,7 @@
 #include <iterator>
 #include <list>
 #include <queue>
+#include <vector>
 
 
 namespace carl {
@@ -299,10 +300,11 @@ private:
 		//     and an corrspoding adapted list
 		std::list<SignCondition> currSigns;
 		std::list<Alpha> currAda;
-		TaQResType taq1 = mTaQ(p);
-		currProducts.push_back(p);
 		Polynomial psquare = p*p;
-		TaQResType taq2 = mTaQ(psquare);
+		std::vector<TaQResType> taqs = mTaQ(std::vector<Polynomial>({p, psquare}));
+		TaQResType taq1 = taqs[0];
+		TaQResType taq2 = taqs[1];
+		currProducts.push_back(p);
 		currProducts.push_back(psquare);
 		CARL_LOG_ASSERT("carl.thom.sign",  std::abs(taq1) <= taq0 && std::abs(taq2) <= taq0, "tarski query failure");
 		int czer = taq0 - taq2;
@@ -328,11 +330,11 @@ private:
 		// (2)
 		products = this->computeProducts(p, currAda);
 		
+		// the queries are independent of each other and computed at once
+		std::vector<TaQResType> queries = mTaQ(std::vector<Polynomial>(products.begin(), products.end()));
 		Eigen::VectorXf dprime(long(products.size()));
-		long index = 0;
-		for (const auto& prod : products) {
-			dprime(index) = float(mTaQ(prod));
-			index++;
+		for (std::size_t index = 0; index < queries.size(); index++) {
+			dprime(long(index)) = float(queries[index]);
 		}
 		
 		Eigen::MatrixXf M_prime = kroneckerProduct(currM, mMatrix);
@@ -76,9 +76,12 @@ private:
 	// the groebner base object is used to compute reductions
 	GroebnerBase<Number> mGb;
 	
+	// the traces of the multiplication by the base elements, such that computing traces needs no monomial arithmetic
+	std::vector<Number> mTraces;
+	
 public:
 	
-	MultiplicationTable() : mTable(), mBase(), mGb() {}
+	MultiplicationTable() : mTable(), mBase(), mGb(), mTraces() {}
 	
 	explicit MultiplicationTable(const GroebnerBase<Number>& gb) : mGb(gb){
 		CARL_LOG_ASSERT("carl.thom.tarski.table", gb.hasFiniteMon(), "tried to set up a multiplication table on infinite basis");
@@ -136,14 +139,14 @@ public:
 	}
 	
 	
+	/*
+	 * the trace is linear, hence it is a combination of the precomputed traces of the base elements.
+	 * this only does arithmetic on numbers and can thus be used concurrently.
+	 */
 	Number trace(const BaseRepresentation<Number>& f) const {
 		Number res(0);
 		for(const auto& index_coeff : f) {
-			for(uint i = 0; i < mBase.size(); i++) {
-				Monomial prod = mBase[index_coeff.first] * mBase[i];
-				BaseRepresentation<Number> prod_br = this->getEntry(prod).br;
-				res += index_coeff.second * prod_br.get(i);
-			}		   
+			res += index_coeff.second * mTraces[index_coeff.first];
 		}
 		return res;
 	}
@@ -292,6 +295,15 @@ private:
 				mTable[m] = {baseRepr, pairs};
 			}
 		}
+		
+		// ---- traces ----
+		// the trace of the multiplication by base_k is the sum of the coefficients of base_i in base_k * base_i
+		mTraces.assign(mBase.size(), Number(0));
+		for(uint k = 0; k < mBase.size(); k++) {
+			for(uint i = 0; i < mBase.size(); i++) {
+				mTraces[k] += this->getEntry(mBase[k] * mBase[i]).br.get(i);
+			}
+		}
 	}
 };
 
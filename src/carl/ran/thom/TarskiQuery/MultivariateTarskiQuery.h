@@ -14,11 +14,13 @@
 namespace carl {
         
         
+/*
+ * computes the tarski query of the polynomial given by its normal form q.
+ * only arithmetic on numbers is done here, hence several queries on the same table can be computed concurrently.
+ */
 template<typename Number>
-int multivariateTarskiQuery(const MultivariatePolynomial<Number>& Q, const MultiplicationTable<Number>& table) {
-        CARL_LOG_FUNC("carl.thom.tarski", "Q = " << Q);
-        BaseRepresentation<Number> q = table.reduce(Q);
-        std::vector<typename MultiplicationTable<Number>::Monomial> base = table.getBase();
+int multivariateTarskiQuery(const BaseRepresentation<Number>& q, const MultiplicationTable<Number>& table) {
+        const auto& base = table.getBase();
         // compute the traces...
         CoeffMatrix<Number> m(base.size(), base.size());
         CARL_LOG_INFO("carl.thom.tarski", "base size is " << base.size());
@@ -67,4 +69,10 @@ int multivariateTarskiQuery(const MultivariatePolynomial<Number>& Q, const Multi
         return v1 - v2;
 }
 
+template<typename Number>
+int multivariateTarskiQuery(const MultivariatePolynomial<Number>& Q, const MultiplicationTable<Number>& table) {
+        CARL_LOG_FUNC("carl.thom.tarski", "Q = " << Q);
+        return multivariateTarskiQuery(table.reduce(Q), table);
+}
+
 } // namespace carl
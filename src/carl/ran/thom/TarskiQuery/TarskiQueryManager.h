@@ -7,7 +7,15 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "MultiplicationTable.h"
 #include "MultivariateTarskiQuery.h"
@@ -20,6 +28,12 @@ namespace carl {
 /*
  * The Tarski query manager is a class designed to manage the computation of Tarski queries.
  * 
+ * Everything that only depends on the zero set (the derivative in the univariate case,
+ * the multiplication table in the multivariate case) as well as the query results are stored in a ZeroSetData object.
+ * These objects are shared by all managers on the same zero set, including copies.
+ * Several queries can be computed at once, in which case the independent computations run concurrently.
+ * The registry of zero sets and the shared query caches are synchronized,
+ * apart from that, managers are not thread-safe, just like the polynomials they work on.
  */ 
 template<typename Number>
 class TarskiQueryManager {
@@ -30,15 +44,41 @@ public:
 private:
         using Polynomial = MultivariatePolynomial<Number>;
         
-        // for the univariate case
-        UnivariatePolynomial<Number> mZ = UnivariatePolynomial<Number>(Variable::NO_VARIABLE);
-        UnivariatePolynomial<Number> mDer = UnivariatePolynomial<Number>(Variable::NO_VARIABLE);
+        struct ZeroSetData {
+                // for the univariate case
+                UnivariatePolynomial<Number> mZ = UnivariatePolynomial<Number>(Variable::NO_VARIABLE);
+                UnivariatePolynomial<Number> mDer = UnivariatePolynomial<Number>(Variable::NO_VARIABLE);
+                
+                // for the multivariate case
+                MultiplicationTable<Number> mTab;
+                bool mTrivialGb = false;
+                
+                // query results on normalized polynomials, guarded by mCacheMutex as the cache is shared by several managers
+                std::map<Polynomial, QueryResultType> mCache;
+                std::mutex mCacheMutex;
+        };
         
-        // for the multivariate case
-        MultiplicationTable<Number> mTab;
-        bool mTrivialGb = false;
+        std::shared_ptr<ZeroSetData> mData = std::make_shared<ZeroSetData>();
         
-        mutable std::map<Polynomial, QueryResultType> mCache;
+        /*
+         * the data of all zero sets that are currently used by some manager, indexed by the sorted polynomials defining the zero set
+         */
+        static std::map<std::vector<Polynomial>, std::weak_ptr<ZeroSetData>>& registry() {
+                static std::map<std::vector<Polynomial>, std::weak_ptr<ZeroSetData>> registry;
+                return registry;
+        }
+        static std::mutex& registryMutex() {
+                static std::mutex mutex;
+                return mutex;
+        }
+        
+        /*
+         * the input for the computation of a single query, which is done concurrently and must thus not involve multivariate polynomials
+         */
+        struct Task {
+                UnivariatePolynomial<Number> univariate = UnivariatePolynomial<Number>(Variable::NO_VARIABLE);
+                BaseRepresentation<Number> reduced;
+        };
         
 public:
         TarskiQueryManager() = default;
@@ -46,12 +86,31 @@ public:
         template<typename InputIt>
         TarskiQueryManager(InputIt first, InputIt last) {
                 CARL_LOG_TRACE("carl.thom.tarski.manager", "setting up a taq manager on " << std::vector<Polynomial>(first, last));
+                std::vector<Polynomial> key(first, last);
+                std::sort(key.begin(), key.end());
+                // the registry stays locked until the data is registered, such that every zero set is set up only once
+                std::lock_guard<std::mutex> lock(registryMutex());
+                auto& reg = registry();
+                // forget the data of zero sets that are no longer used
+                for(auto it = reg.begin(); it != reg.end(); ) {
+                        if(it->second.expired()) it = reg.erase(it);
+                        else it++;
+                }
+                auto it = reg.find(key);
+                if(it != reg.end()) {
+                        // the last manager using the data may have been destroyed in the meantime
+                        if(auto data = it->second.lock()) {
+                                CARL_LOG_TRACE("carl.thom.tarski.manager", "reusing the data of another manager");
+                                mData = std::move(data);
+                                return;
+                        }
+                }
                 // univariate manager
                 if(std::distance(first, last) == 1 && first->isUnivariate()) {
                         CARL_LOG_TRACE("carl.thom.tarski.manager", "as a UNIVARIATE manager");
-                        mZ = carl::to_univariate_polynomial(*first);
-                        CARL_LOG_ASSERT("carl.thom.tarski.manager", !carl::isZero(mZ), "");
-                        mDer = derivative(mZ);
+                        mData->mZ = carl::to_univariate_polynomial(*first);
+                        CARL_LOG_ASSERT("carl.thom.tarski.manager", !carl::isZero(mData->mZ), "");
+                        mData->mDer = derivative(mData->mZ);
                         CARL_LOG_ASSERT("carl.thom.tarski.manager", this->isUnivariateManager(), "");
                 }
                 // multivariate manager
@@ -59,7 +118,7 @@ public:
                         CARL_LOG_TRACE("carl.thom.tarski.manager", "as a MULTIVARIATE manager");
                         GroebnerBase<Number> gb(first, last);
                         if(gb.isTrivialBase()) {
-                                mTrivialGb = true;
+                                mData->mTrivialGb = true;
                         }
                         else {
                                 CARL_LOG_ASSERT("carl.thom.tarski.manager", gb.hasFiniteMon(), "");
@@ -67,58 +126,96 @@ public:
                                         std::cout << "aborting because it was tried to set up a tarki query manager on a non zero-dimensional zero set" << std::endl;
                                         std::exit(23);
                                 }
-                                mTab = MultiplicationTable<Number>(gb);
+                                mData->mTab = MultiplicationTable<Number>(gb);
                         }
                         CARL_LOG_ASSERT("carl.thom.tarski.manager", !this->isUnivariateManager(), "");
                 }
+                reg[key] = mData;
         }
         
         QueryResultType operator()(const Polynomial& p) const {
-                CARL_LOG_TRACE("carl.thom.tarski.manager", "computing taq on " << p << " ... ");
-                if(carl::isZero(p)) return 0;
-                QueryResultType res;
-                
-                // return cached query result
-                if(getCached(p, res)) {
-                        CARL_LOG_TRACE("carl.thom.tarski.manager", "found in cache: " << res);
-                        return res;
+                return (*this)(std::vector<Polynomial>({p})).front();
+        }
+        
+        QueryResultType operator()(const Number& c) const {
+                return (*this)(Polynomial(c));
+        }
+        
+        /*
+         * computes the tarski queries of several polynomials.
+         * the queries that are not cached yet are computed concurrently by the given number of threads,
+         * where zero means one thread per hardware thread.
+         */
+        std::vector<QueryResultType> operator()(const std::vector<Polynomial>& polys, std::size_t threads = 0) const {
+                std::vector<QueryResultType> res(polys.size(), 0);
+                // the tasks by normalized polynomial, and for every polynomial the task it waits for
+                std::map<Polynomial, std::size_t> pending;
+                std::vector<std::pair<std::size_t, std::size_t>> waiting;
+                std::vector<Task> tasks;
+                std::vector<Polynomial> normalized;
+                for(std::size_t i = 0; i < polys.size(); i++) {
+                        const Polynomial& p = polys[i];
+                        CARL_LOG_TRACE("carl.thom.tarski.manager", "computing taq on " << p << " ... ");
+                        if(carl::isZero(p)) continue;
+                        // return cached query result
+                        if(getCached(p, res[i])) {
+                                CARL_LOG_TRACE("carl.thom.tarski.manager", "found in cache: " << res[i]);
+                                continue;
+                        }
+                        Polynomial n = p.normalize();
+                        auto it = pending.find(n);
+                        if(it == pending.end()) {
+                                it = pending.emplace(n, tasks.size()).first;
+                                tasks.push_back(prepare(n));
+                                normalized.push_back(n);
+                        }
+                        waiting.emplace_back(i, it->second);
                 }
                 
-                // univariate manager
-                if(this->isUnivariateManager()) {
-                        CARL_LOG_ASSERT("carl.thom.tarski.manager", p.isUnivariate(), "");
-                        UnivariatePolynomial<Number> pUniv(Variable::NO_VARIABLE);
-                        if(p.isConstant()) pUniv = UnivariatePolynomial<Number>(mZ.mainVar(), p.lcoeff());
-                        else pUniv = carl::to_univariate_polynomial(p);
-                        CARL_LOG_ASSERT("carl.thom.tarski.manager", pUniv.mainVar() == mZ.mainVar(),
-                                "cannot compute tarski query of " << p << " on " << mZ);
-                        res = univariateTarskiQuery(pUniv, mZ, mDer);
+                std::vector<QueryResultType> results(tasks.size(), 0);
+                std::atomic<std::size_t> next(0);
+                std::vector<std::exception_ptr> errors(tasks.size());
+                auto worker = [&]() {
+                        for(std::size_t k = next++; k < tasks.size(); k = next++) {
+                                try {
+                                        results[k] = compute(tasks[k]);
+                                } catch (...) {
+                                        errors[k] = std::current_exception();
+                                }
+                        }
+                };
+                if(threads == 0) threads = std::max(std::thread::hardware_concurrency(), 1u);
+                threads = std::min(threads, tasks.size());
+                if(threads <= 1) {
+                        worker();
                 }
-                
-                // multivariate manager
                 else {
-                        if(mTrivialGb) res = 0;
-                        else {
-                        // todo: check if variables in p are also in the polynomials defining the zero set
-                                res = multivariateTarskiQuery(p, mTab);
-                        }
+                        CARL_LOG_DEBUG("carl.thom.tarski.manager", "computing " << tasks.size() << " queries with " << threads << " threads");
+                        std::vector<std::thread> pool;
+                        for(std::size_t t = 0; t < threads; t++) pool.emplace_back(worker);
+                        for(auto& t : pool) t.join();
+                }
+                for(const auto& e : errors) {
+                        if(e) std::rethrow_exception(e);
+                }
+                
+                for(std::size_t k = 0; k < tasks.size(); k++) {
+                        cache(normalized[k], results[k]);
+                }
+                for(const auto& w : waiting) {
+                        res[w.first] = int(sgn(polys[w.first].lcoeff())) * results[w.second];
+                        CARL_LOG_TRACE("carl.thom.tarski.manager", polys[w.first] << " -> " << res[w.first]);
                 }
-                cache(p, res);
-                CARL_LOG_TRACE("carl.thom.tarski.manager", res);
                 return res;
         }
         
-        QueryResultType operator()(const Number& c) const {
-                return (*this)(Polynomial(c));
-        }
-        
         Polynomial reduceProduct(const Polynomial& a, const Polynomial& b) const {
                 if(this->isUnivariateManager()) {
                         // todo: implement
                         return a * b;
                 }
                 else {
-                        return mTab.baseReprToPolynomial(mTab.reduce(a * b));
+                        return mData->mTab.baseReprToPolynomial(mData->mTab.reduce(a * b));
                 }
                 
         }
@@ -128,15 +225,48 @@ public:
 private:
         
         bool isUnivariateManager() const {
-                return !carl::isZero(mZ);
+                return !carl::isZero(mData->mZ);
+        }
+        
+        /*
+         * does all computations on multivariate polynomials that are necessary for the query on p
+         */
+        Task prepare(const Polynomial& p) const {
+                Task task;
+                if(this->isUnivariateManager()) {
+                        CARL_LOG_ASSERT("carl.thom.tarski.manager", p.isUnivariate(), "");
+                        if(p.isConstant()) task.univariate = UnivariatePolynomial<Number>(mData->mZ.mainVar(), p.lcoeff());
+                        else task.univariate = carl::to_univariate_polynomial(p);
+                        CARL_LOG_ASSERT("carl.thom.tarski.manager", task.univariate.mainVar() == mData->mZ.mainVar(),
+                                "cannot compute tarski query of " << p << " on " << mData->mZ);
+                }
+                else if(!mData->mTrivialGb) {
+                        // todo: check if variables in p are also in the polynomials defining the zero set
+                        task.reduced = mData->mTab.reduce(p);
+                }
+                return task;
+        }
+        
+        /*
+         * computes a query from its prepared input
+         */
+        QueryResultType compute(const Task& task) const {
+                if(this->isUnivariateManager()) {
+                        return univariateTarskiQuery(task.univariate, mData->mZ, mData->mDer);
+                }
+                else if(mData->mTrivialGb) {
+                        return 0;
+                }
+                return multivariateTarskiQuery(task.reduced, mData->mTab);
         }
         
         /*
          * looks for the normalization of p in the cache
          */
         bool getCached(const Polynomial& p, QueryResultType& res) const {
-                auto it = mCache.find(p.normalize());
-                if(it != mCache.end()) {
+                std::lock_guard<std::mutex> lock(mData->mCacheMutex);
+                auto it = mData->mCache.find(p.normalize());
+                if(it != mData->mCache.end()) {
 						res = int(sgn(p.lcoeff())) * (it->second);
                         return true;
                 }
@@ -147,7 +277,8 @@ private:
          * writes normalized p with correspoding result in cache
          */
         void cache(const Polynomial& p, const QueryResultType res) const {
-                mCache.insert(std::make_pair(p.normalize(), int(sgn(p.lcoeff())) * res));
+                std::lock_guard<std::mutex> lock(mData->mCacheMutex);
+                mData->mCache.insert(std::make_pair(p.normalize(), int(sgn(p.lcoeff())) * res));
         }
         
 }; // class TarskiQueryManager
@@ -9,6 +9,9 @@
 
 #include <carl/core/Sign.h>
 #include <carl/core/UnivariatePolynomial.h>
+#include <carl/core/polynomialfunctions/Derivative.h>
+#include <carl/core/polynomialfunctions/SignVariations.h>
+#include <carl/core/polynomialfunctions/SturmSequence.h>
 
 namespace carl {
 
@@ -46,7 +49,7 @@ int univariateTarskiQuery(const UnivariatePolynomial<Number>& p, const Univariat
 
 template<typename Number>
 int univariateTarskiQuery(const UnivariatePolynomial<Number>& p, const UnivariatePolynomial<Number>& q) {
-        return univariateTarskiQuery(p, q, q.derivative());
+        return univariateTarskiQuery(p, q, carl::derivative(q));
 }
 
 } // namespace carl
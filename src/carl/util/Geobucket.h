@@ -0,0 +1,267 @@
+/**
+ * @file Geobucket.h
+ * A geobucket priority queue in the spirit of the data structures from mathic @cite Mathic .
+ * It offers the same interface as Heap and can be used in its place.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace carl
+{
+    /** A geobucket priority queue.
+
+        Configuration serves the same role as for Heap. Entries are kept in a
+        sequence of sorted buckets whose capacities grow geometrically. New
+        entries go to the smallest bucket, and a bucket that exceeds its
+        capacity is merged into the next one. The top is the greatest of the
+        bucket maxima, which are cached.
+
+        If Configuration::supportDeduplicationWhileOrdering is true, entries
+        that compare equal are chained whenever they meet, that is when an entry
+        is inserted into the first bucket and when two buckets are merged.
+        The entries of a chain are handed out one after another by top() and
+        pop() without any further comparisons.
+    */
+    template<class C>
+    class Geobucket
+    {
+        public:
+            using Configuration = C;
+            using Entry = typename Configuration::Entry;
+
+            /// Capacity of the first bucket.
+            static const size_t minBucketSize = 8;
+            /// Factor between the capacities of consecutive buckets.
+            static const size_t geoBase = 4;
+
+            explicit Geobucket( const Configuration& configuration ):
+                _buckets(),
+                _maxBucket( NONE ),
+                _size( 0 ),
+                _conf( configuration )
+            {}
+
+            Configuration& getConfiguration()
+            {
+                return _conf;
+            }
+
+            const Configuration& getConfiguration() const
+            {
+                return _conf;
+            }
+
+            std::string getName() const;
+            void push( Entry entry );
+            Entry pop();
+
+            Entry top() const
+            {
+                assert( !empty() );
+                return _buckets[maxBucket()].back().back();
+            }
+
+            bool empty() const
+            {
+                return _size == 0;
+            }
+
+            size_t size() const
+            {
+                return _size;
+            }
+
+            /// As for Heap, the top must have been requested by top() before it was changed.
+            void decreaseTop( Entry newEntry )
+            {
+                pop();
+                push( newEntry );
+            }
+
+            void print( std::ostream& out = std::cout ) const;
+
+            size_t getMemoryUse() const;
+
+        private:
+            using Chain = std::vector<Entry>;
+            /// A bucket is sorted ascendingly, hence its greatest chain is at the back.
+            using Bucket = std::vector<Chain>;
+            static constexpr size_t NONE = std::numeric_limits<size_t>::max();
+
+            bool less( const Chain& a, const Chain& b ) const
+            {
+                return _conf.cmpLessThan( _conf.compare( a.back(), b.back() ));
+            }
+
+            size_t bucketCapacity( size_t index ) const
+            {
+                size_t res = minBucketSize;
+                for( size_t i = 0; i < index; ++i )
+                    res *= geoBase;
+                return res;
+            }
+
+            size_t maxBucket() const;
+            void insert( Entry entry );
+            void merge( size_t index );
+
+            std::vector<Bucket> _buckets;
+            /// Cache for the index of the bucket holding the top, NONE if invalid.
+            mutable size_t      _maxBucket;
+            size_t              _size;
+            Configuration       _conf;
+    };
+
+    template<class C>
+    std::string Geobucket<C>::getName() const
+    {
+        return std::string( "geobucket(" ) + (C::supportDeduplicationWhileOrdering ? "chained" : "") + ')';
+    }
+
+    template<class C>
+    size_t Geobucket<C>::getMemoryUse() const
+    {
+        size_t res = _buckets.capacity() * sizeof( Bucket );
+        for( const Bucket& b: _buckets )
+        {
+            res += b.capacity() * sizeof( Chain );
+            for( const Chain& c: b )
+                res += c.capacity() * sizeof( Entry );
+        }
+        return res;
+    }
+
+    template<class C>
+    void Geobucket<C>::push( Entry entry )
+    {
+        if( _buckets.empty() )
+            _buckets.emplace_back();
+        insert( entry );
+        ++_size;
+        if( _buckets.front().size() > bucketCapacity( 0 ))
+            merge( 0 );
+        _maxBucket = NONE;
+    }
+
+    template<class C>
+    typename Geobucket<C>::Entry Geobucket<C>::pop()
+    {
+        assert( !empty() );
+        Bucket& bucket = _buckets[maxBucket()];
+        Entry top = bucket.back().back();
+        bucket.back().pop_back();
+        // The remaining entries of a chain are equal, hence the cache stays valid.
+        if( bucket.back().empty() )
+        {
+            bucket.pop_back();
+            _maxBucket = NONE;
+        }
+        --_size;
+        return top;
+    }
+
+    template<class C>
+    void Geobucket<C>::print( std::ostream& out ) const
+    {
+        out << getName() << _size << ": {";
+        for( const Bucket& b: _buckets )
+        {
+            out << "[ ";
+            for( const Chain& c: b )
+            {
+                for( const Entry& e: c )
+                    out << e << ' ';
+            }
+            out << "] ";
+        }
+        out << "}\n";
+    }
+
+    template<class C>
+    size_t Geobucket<C>::maxBucket() const
+    {
+        if( _maxBucket == NONE )
+        {
+            for( size_t i = 0; i < _buckets.size(); ++i )
+            {
+                if( _buckets[i].empty() )
+                    continue;
+                if( _maxBucket == NONE || less( _buckets[_maxBucket].back(), _buckets[i].back() ))
+                    _maxBucket = i;
+            }
+        }
+        assert( _maxBucket != NONE );
+        return _maxBucket;
+    }
+
+    template<class C>
+    void Geobucket<C>::insert( Entry entry )
+    {
+        Bucket& bucket = _buckets.front();
+        // Binary search for the first chain greater than entry.
+        size_t lower = 0;
+        size_t upper = bucket.size();
+        while( lower < upper )
+        {
+            size_t mid = (lower + upper) / 2;
+            if( _conf.cmpLessThan( _conf.compare( entry, bucket[mid].back() )))
+                upper = mid;
+            else
+                lower = mid + 1;
+        }
+        if( C::supportDeduplicationWhileOrdering && lower > 0 && _conf.cmpEqual( _conf.compare( bucket[lower - 1].back(), entry )))
+        {
+            bucket[lower - 1].push_back( entry );
+            return;
+        }
+        bucket.insert( bucket.begin() + long( lower ), Chain( 1, entry ));
+    }
+
+    template<class C>
+    void Geobucket<C>::merge( size_t index )
+    {
+        for( ; _buckets[index].size() > bucketCapacity( index ); ++index )
+        {
+            if( index + 1 == _buckets.size() )
+                _buckets.emplace_back();
+            Bucket& src = _buckets[index];
+            Bucket& dest = _buckets[index + 1];
+            Bucket merged;
+            merged.reserve( src.size() + dest.size() );
+            auto s = src.begin();
+            auto d = dest.begin();
+            while( s != src.end() && d != dest.end() )
+            {
+                typename C::CompareResult cmp = _conf.compare( s->back(), d->back() );
+                if( _conf.cmpLessThan( cmp ))
+                {
+                    merged.push_back( std::move( *s ));
+                    ++s;
+                }
+                else if( C::supportDeduplicationWhileOrdering && _conf.cmpEqual( cmp ))
+                {
+                    d->insert( d->end(), s->begin(), s->end() );
+                    merged.push_back( std::move( *d ));
+                    ++s;
+                    ++d;
+                }
+                else
+                {
+                    merged.push_back( std::move( *d ));
+                    ++d;
+                }
+            }
+            merged.insert( merged.end(), std::make_move_iterator( s ), std::make_move_iterator( src.end() ));
+            merged.insert( merged.end(), std::make_move_iterator( d ), std::make_move_iterator( dest.end() ));
+            src.clear();
+            dest.swap( merged );
+        }
+    }
+}
@@ -0,0 +1,257 @@
+/**
+ * @file TourTree.h
+ * A tournament tree priority queue in the spirit of the data structures from mathic @cite Mathic .
+ * It offers the same interface as Heap and can be used in its place.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace carl
+{
+    /** A chained tournament tree priority queue.
+
+        Configuration serves the same role as for Heap. Entries are stored in
+        the leaves of a complete binary tree and every inner node knows the leaf
+        holding the greatest entry of its subtree. Hence, changing an entry only
+        replays the matches on the path from its leaf to the root.
+
+        If Configuration::supportDeduplicationWhileOrdering is true, an entry
+        that compares equal to the winner of a sibling subtree on its path is
+        chained to this winner instead of occupying a leaf of its own. The
+        entries of a chain are handed out one after another by top() and pop()
+        without any further comparisons. As the overall winner is always among
+        these siblings, an entry equal to the current top is always chained.
+    */
+    template<class C>
+    class TourTree
+    {
+        public:
+            using Configuration = C;
+            using Entry = typename Configuration::Entry;
+
+            explicit TourTree( const Configuration& configuration ):
+                _winners(),
+                _leaves(),
+                _free(),
+                _size( 0 ),
+                _conf( configuration )
+            {}
+
+            Configuration& getConfiguration()
+            {
+                return _conf;
+            }
+
+            const Configuration& getConfiguration() const
+            {
+                return _conf;
+            }
+
+            std::string getName() const;
+            void push( Entry entry );
+            Entry pop();
+
+            Entry top() const
+            {
+                assert( !empty() );
+                return _leaves[_winners[1]].back();
+            }
+
+            bool empty() const
+            {
+                return _size == 0;
+            }
+
+            size_t size() const
+            {
+                return _size;
+            }
+
+            void decreaseTop( Entry newEntry );
+
+            void print( std::ostream& out = std::cout ) const;
+
+            size_t getMemoryUse() const;
+
+        private:
+            using Chain = std::vector<Entry>;
+            static constexpr size_t NONE = std::numeric_limits<size_t>::max();
+
+            size_t capacity() const
+            {
+                return _leaves.size();
+            }
+
+            size_t winner( size_t a, size_t b ) const
+            {
+                if( a == NONE ) return b;
+                if( b == NONE ) return a;
+                return _conf.cmpLessThan( _conf.compare( _leaves[a].back(), _leaves[b].back() )) ? b : a;
+            }
+
+            size_t freeLeaf();
+            void grow();
+            bool chain( size_t leaf, Entry entry );
+            void place( size_t leaf, Entry entry );
+            void release( size_t leaf );
+            void replay( size_t leaf );
+
+            /// For every node the leaf holding the winner of its subtree, the root is at 1 and leaf i at capacity() + i.
+            std::vector<size_t> _winners;
+            /// The chain of equal entries of every leaf, empty for unused leaves.
+            std::vector<Chain>  _leaves;
+            /// The unused leaves.
+            std::vector<size_t> _free;
+            size_t              _size;
+            Configuration       _conf;
+    };
+
+    template<class C>
+    std::string TourTree<C>::getName() const
+    {
+        return std::string( "tourtree(" ) + (C::supportDeduplicationWhileOrdering ? "chained" : "") + ')';
+    }
+
+    template<class C>
+    size_t TourTree<C>::getMemoryUse() const
+    {
+        size_t res = _winners.capacity() * sizeof( size_t ) + _free.capacity() * sizeof( size_t );
+        for( const Chain& c: _leaves )
+            res += sizeof( Chain ) + c.capacity() * sizeof( Entry );
+        return res;
+    }
+
+    template<class C>
+    void TourTree<C>::push( Entry entry )
+    {
+        size_t leaf = freeLeaf();
+        if( C::supportDeduplicationWhileOrdering && chain( leaf, entry ))
+            _free.push_back( leaf );
+        else
+            place( leaf, entry );
+        ++_size;
+    }
+
+    template<class C>
+    typename TourTree<C>::Entry TourTree<C>::pop()
+    {
+        assert( !empty() );
+        size_t leaf = _winners[1];
+        Entry top = _leaves[leaf].back();
+        _leaves[leaf].pop_back();
+        // The remaining entries of a chain are equal, hence the winners do not change.
+        if( _leaves[leaf].empty() )
+            release( leaf );
+        --_size;
+        return top;
+    }
+
+    template<class C>
+    void TourTree<C>::decreaseTop( Entry newEntry )
+    {
+        assert( !empty() );
+        size_t leaf = _winners[1];
+        _leaves[leaf].pop_back();
+        if( !_leaves[leaf].empty() )
+        {
+            --_size;
+            push( newEntry );
+        }
+        else if( C::supportDeduplicationWhileOrdering && chain( leaf, newEntry ))
+        {
+            release( leaf );
+        }
+        else
+        {
+            // Reuse the leaf of the old top.
+            place( leaf, newEntry );
+        }
+    }
+
+    template<class C>
+    void TourTree<C>::print( std::ostream& out ) const
+    {
+        out << getName() << _size << ": {";
+        for( const Chain& c: _leaves )
+        {
+            for( const Entry& e: c )
+                out << e << ' ';
+        }
+        out << "}\n";
+    }
+
+    template<class C>
+    size_t TourTree<C>::freeLeaf()
+    {
+        if( _free.empty() )
+            grow();
+        size_t leaf = _free.back();
+        _free.pop_back();
+        return leaf;
+    }
+
+    template<class C>
+    void TourTree<C>::grow()
+    {
+        size_t oldCapacity = capacity();
+        size_t newCapacity = oldCapacity == 0 ? 4 : 2 * oldCapacity;
+        _leaves.resize( newCapacity );
+        _winners.assign( 2 * newCapacity, NONE );
+        for( size_t i = 0; i < oldCapacity; ++i )
+        {
+            if( !_leaves[i].empty() )
+                _winners[newCapacity + i] = i;
+        }
+        for( size_t n = newCapacity - 1; n > 0; --n )
+            _winners[n] = winner( _winners[2 * n], _winners[2 * n + 1] );
+        // Hand out the new leaves from left to right.
+        for( size_t i = newCapacity; i > oldCapacity; --i )
+            _free.push_back( i - 1 );
+    }
+
+    template<class C>
+    bool TourTree<C>::chain( size_t leaf, Entry entry )
+    {
+        for( size_t n = capacity() + leaf; n > 1; n /= 2 )
+        {
+            size_t w = _winners[n ^ 1];
+            if( w != NONE && _conf.cmpEqual( _conf.compare( _leaves[w].back(), entry )))
+            {
+                _leaves[w].push_back( entry );
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template<class C>
+    void TourTree<C>::place( size_t leaf, Entry entry )
+    {
+        assert( _leaves[leaf].empty() );
+        _leaves[leaf].push_back( entry );
+        _winners[capacity() + leaf] = leaf;
+        replay( leaf );
+    }
+
+    template<class C>
+    void TourTree<C>::release( size_t leaf )
+    {
+        assert( _leaves[leaf].empty() );
+        _winners[capacity() + leaf] = NONE;
+        _free.push_back( leaf );
+        replay( leaf );
+    }
+
+    template<class C>
+    void TourTree<C>::replay( size_t leaf )
+    {
+        for( size_t n = (capacity() + leaf) / 2; n > 0; n /= 2 )
+            _winners[n] = winner( _winners[2 * n], _winners[2 * n + 1] );
+    }
+}
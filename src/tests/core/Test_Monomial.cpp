@@ -234,6 +234,59 @@ TEST(Monomial, OtherComparison)
 	expectRightOrder(list);
 }
 
+TEST(Monomial, LexicalComparison)
+{
+	auto x = carl::freshRealVariable("x");
+	auto y = carl::freshRealVariable("y");
+	auto z = carl::freshRealVariable("z");
+	auto cmp = [](const carl::Monomial::Arg& lhs, const carl::Monomial::Arg& rhs) {
+		return carl::Monomial::compareLexical(lhs, rhs);
+	};
+
+	// All monomials in x, y, z with exponents up to two, including the constant monomial.
+	std::vector<carl::Monomial::Arg> monomials;
+	for (carl::exponent ex = 0; ex <= 2; ++ex) {
+		for (carl::exponent ey = 0; ey <= 2; ++ey) {
+			for (carl::exponent ez = 0; ez <= 2; ++ez) {
+				carl::Monomial::Arg m;
+				if (ex > 0) m = m * carl::createMonomial(x, ex);
+				if (ey > 0) m = m * carl::createMonomial(y, ey);
+				if (ez > 0) m = m * carl::createMonomial(z, ez);
+				monomials.push_back(m);
+			}
+		}
+	}
+	// Admissibility: 1 <= m, and m < m' implies m*t < m'*t.
+	for (const auto& m: monomials) {
+		EXPECT_NE(carl::CompareResult::GREATER, cmp(nullptr, m)) << m;
+		EXPECT_EQ(carl::CompareResult::EQUAL, cmp(m, m)) << m;
+	}
+	for (const auto& m1: monomials) {
+		for (const auto& m2: monomials) {
+			if (cmp(m1, m2) != carl::CompareResult::LESS) continue;
+			EXPECT_EQ(carl::CompareResult::GREATER, cmp(m2, m1)) << m1 << " < " << m2;
+			for (const auto& t: monomials) {
+				EXPECT_EQ(carl::CompareResult::LESS, cmp(m1 * t, m2 * t)) << m1 << " < " << m2 << " times " << t;
+			}
+		}
+	}
+
+	// Greater variables are more significant, as for the graded ordering on variables.
+	ASSERT_TRUE(x < y && y < z);
+	EXPECT_EQ(carl::CompareResult::LESS, cmp(carl::createMonomial(x, 5), carl::createMonomial(y, 1)));
+	EXPECT_EQ(carl::CompareResult::LESS, cmp(x * carl::createMonomial(y, 3), carl::createMonomial(z, 1)));
+	EXPECT_EQ(carl::CompareResult::GREATER, cmp(x * y * y, carl::createMonomial(x, 5) * y));
+	EXPECT_EQ(carl::CompareResult::LESS, carl::Monomial::compareGradedLexical(carl::createMonomial(x, 1), carl::createMonomial(y, 1)));
+
+	// Comparison with a single variable follows the same convention.
+	EXPECT_EQ(carl::CompareResult::EQUAL, carl::Monomial::compareLexical(carl::createMonomial(y, 1), y));
+	EXPECT_EQ(carl::CompareResult::GREATER, carl::Monomial::compareLexical(x * y, y));
+	EXPECT_EQ(carl::CompareResult::GREATER, carl::Monomial::compareLexical(carl::createMonomial(y, 2), y));
+	EXPECT_EQ(carl::CompareResult::LESS, carl::Monomial::compareLexical(carl::createMonomial(x, 3), y));
+	EXPECT_EQ(carl::CompareResult::GREATER, carl::Monomial::compareLexical(x * z, y));
+	EXPECT_EQ(carl::CompareResult::LESS, carl::Monomial::compareLexical(nullptr, y));
+}
+
 TEST(Monomial, sqrt)
 {
 	auto x = carl::freshRealVariable("x");
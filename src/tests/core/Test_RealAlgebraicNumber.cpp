@@ -3,6 +3,7 @@
 
 #include "carl/core/UnivariatePolynomial.h"
 #include "carl/ran/ran.h"
+#include "carl/ran/real_roots.h"
 
 #include "../Common.h"
 
@@ -102,3 +103,176 @@ TEST(RealAlgebraicNumber, EvalBug2)
 
 
 
+
+TEST(RealAlgebraicNumber, DyadicRefinement)
+{
+	Variable x = freshRealVariable("x");
+	UnivariatePolynomial<Rational> p(x, std::initializer_list<Rational>{-2, 0, 1});
+	// Isolating interval for sqrt(2) with non-dyadic endpoints.
+	RealAlgebraicNumber<Rational> ran(p, Interval<Rational>(Rational(4)/3, BoundType::STRICT, Rational(3)/2, BoundType::STRICT));
+	for (int i = 0; i < 40; ++i) {
+		ran.refine();
+		EXPECT_TRUE(ran.interval().contains(Rational(14142135623)/10000000000) || ran.interval().diameter() < Rational(1)/10000000000);
+	}
+	// Both endpoints are dyadic after refinement.
+	auto is_dyadic = [](const Rational& r) {
+		mpz_class den = carl::getDenom(r);
+		return (den & (den - 1)) == 0;
+	};
+	EXPECT_TRUE(is_dyadic(ran.interval().lower()));
+	EXPECT_TRUE(is_dyadic(ran.interval().upper()));
+	EXPECT_TRUE(ran.interval().diameter() < Rational(1)/1000000000);
+	EXPECT_TRUE(carl::sgn(carl::evaluate(p, ran.interval().lower())) == Sign::NEGATIVE);
+	EXPECT_TRUE(carl::sgn(carl::evaluate(p, ran.interval().upper())) == Sign::POSITIVE);
+
+	// Integer evaluation at rational and dyadic points.
+	std::vector<mpz_class> coeffs = {-2, 0, 1};
+	EXPECT_EQ(Sign::NEGATIVE, carl::sgn_at(coeffs, mpz_class(181), mpz_class(128)));
+	EXPECT_EQ(Sign::POSITIVE, carl::sgn_at(coeffs, mpz_class(182), mpz_class(128)));
+	EXPECT_EQ(Sign::NEGATIVE, carl::sgn_at(coeffs, mpz_class(140), mpz_class(99)));
+	EXPECT_EQ(Sign::POSITIVE, carl::sgn_at(coeffs, mpz_class(99), mpz_class(70)));
+	EXPECT_EQ(Sign::ZERO, carl::sgn_at(std::vector<mpz_class>({-1, 0, 4}), mpz_class(1), mpz_class(2)));
+}
+
+TEST(RealAlgebraicNumber, FloatingPointFilter)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Interval<Rational> unit(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT);
+	RealAlgebraicNumber<Rational> sqrt2(UnivariatePolynomial<Rational>(x, std::initializer_list<Rational>{-2, 0, 1}), unit);
+	RealAlgebraicNumber<Rational> sqrt3(UnivariatePolynomial<Rational>(x, std::initializer_list<Rational>{-3, 0, 1}), unit);
+	// sqrt(2 + 10^-40) is not distinguishable from sqrt(2) with doubles.
+	Rational eps = Rational(1) / carl::pow(Rational(10), 40);
+	RealAlgebraicNumber<Rational> close(UnivariatePolynomial<Rational>(x, std::initializer_list<Rational>{-2 - eps, 0, 1}), unit);
+
+	EXPECT_TRUE(sqrt2 < sqrt3);
+	EXPECT_TRUE(sqrt3 > sqrt2);
+	EXPECT_TRUE(sqrt2 < close);
+	EXPECT_TRUE(close != sqrt2);
+	EXPECT_TRUE(sqrt2 > Rational(Rational(141421356)/100000000));
+	EXPECT_TRUE(sqrt2 < Rational(Rational(141421357)/100000000));
+
+	EXPECT_EQ(Sign::NEGATIVE, sqrt2.sgn(UnivariatePolynomial<Rational>(x, std::initializer_list<Rational>{-3, 0, 1})));
+	EXPECT_EQ(Sign::POSITIVE, sqrt3.sgn(UnivariatePolynomial<Rational>(x, std::initializer_list<Rational>{-2, 0, 1})));
+	// The filter cannot show that a polynomial vanishes, this is done exactly.
+	EXPECT_EQ(Sign::ZERO, sqrt2.sgn(UnivariatePolynomial<Rational>(x, std::initializer_list<Rational>{-4, 0, 0, 0, 1})));
+
+	carl::ran::RANMap<Rational> eval;
+	eval.emplace(x, sqrt2);
+	eval.emplace(y, sqrt3);
+	MultivariatePolynomial<Rational> px(x);
+	MultivariatePolynomial<Rational> py(y);
+	using ConstraintT = Constraint<MultivariatePolynomial<Rational>>;
+	EXPECT_TRUE((bool)carl::evaluate(ConstraintT(px * py - Rational(2), Relation::GREATER), eval));
+	EXPECT_FALSE((bool)carl::evaluate(ConstraintT(px * px - py * py, Relation::GEQ), eval));
+	EXPECT_TRUE((bool)carl::evaluate(ConstraintT(px * px - Rational(2), Relation::EQ), eval));
+	EXPECT_FALSE((bool)carl::evaluate(ConstraintT(px * px * py * py - Rational(6), Relation::LESS), eval));
+}
+
+TEST(RealAlgebraicNumber, QuadraticRefinement)
+{
+	Variable x = freshRealVariable("x");
+	UnivariatePolynomial<Rational> p(x, std::initializer_list<Rational>{-2, 0, 0, 1});
+	RealAlgebraicNumber<Rational> cbrt2(p, Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT));
+	Rational precision = Rational(1) / carl::pow(Rational(2), 200);
+	cbrt2.refine_to_precision(200);
+	ASSERT_FALSE(cbrt2.is_numeric());
+	EXPECT_TRUE(cbrt2.interval().diameter() <= precision);
+	EXPECT_TRUE(carl::sgn(carl::evaluate(p, cbrt2.interval().lower())) == Sign::NEGATIVE);
+	EXPECT_TRUE(carl::sgn(carl::evaluate(p, cbrt2.interval().upper())) == Sign::POSITIVE);
+	// Refining further does not change anything.
+	auto interval = cbrt2.interval();
+	cbrt2.refine_to_precision(100);
+	EXPECT_EQ(interval, cbrt2.interval());
+
+	// Dyadic roots are found exactly, as all points probed by the refinement are dyadic.
+	UnivariatePolynomial<Rational> q(x, std::initializer_list<Rational>{15, -10, -3, 2}); // (2x - 3) * (x^2 - 5)
+	RealAlgebraicNumber<Rational> r(q, Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT));
+	r.refine_to_precision(100);
+	ASSERT_TRUE(r.is_numeric());
+	EXPECT_EQ(Rational(3)/2, r.value());
+}
+
+TEST(RealAlgebraicNumber, SharedRootCounting)
+{
+	Variable x = freshRealVariable("x");
+	UnivariatePolynomial<Rational> p(x, std::initializer_list<Rational>{1, -3, 0, 1});
+	auto roots = carl::real_roots(p).roots();
+	ASSERT_EQ(3, roots.size());
+	// All roots share the root counting data of p.
+	for (const auto& r: roots) {
+		ASSERT_FALSE(r.is_numeric());
+		EXPECT_EQ(roots.front().root_counting(), r.root_counting());
+		EXPECT_EQ(1, r.root_counting()->count_real_roots(r.interval()));
+	}
+	EXPECT_EQ(3, roots.front().root_counting()->count_real_roots(Interval<Rational>(-10, BoundType::STRICT, 10, BoundType::STRICT)));
+
+	// Repeated evaluations reuse the result of the algebraic substitution.
+	carl::ran::RANMap<Rational> eval;
+	eval.emplace(x, roots.back());
+	MultivariatePolynomial<Rational> q = MultivariatePolynomial<Rational>(x) * MultivariatePolynomial<Rational>(x) - Rational(1);
+	auto first = carl::evaluate(q, eval);
+	auto second = carl::evaluate(q, eval);
+	ASSERT_TRUE(first && second);
+	ASSERT_FALSE(first->is_numeric());
+	ASSERT_FALSE(second->is_numeric());
+	EXPECT_EQ(first->root_counting(), second->root_counting());
+	EXPECT_TRUE(*first == *second);
+
+	// Only the results for the most recently used polynomials are kept.
+	for (int i = 2; i < 9; ++i) {
+		ASSERT_TRUE(carl::evaluate(q + Rational(i) * MultivariatePolynomial<Rational>(x), eval));
+	}
+	auto third = carl::evaluate(q, eval);
+	ASSERT_TRUE(third && !third->is_numeric());
+	EXPECT_EQ(first->root_counting(), third->root_counting());
+	ASSERT_TRUE(carl::evaluate(q + Rational(9) * MultivariatePolynomial<Rational>(x), eval));
+	for (int i = 2; i < 9; ++i) {
+		ASSERT_TRUE(carl::evaluate(q + Rational(i + 8) * MultivariatePolynomial<Rational>(x), eval));
+	}
+	auto fourth = carl::evaluate(q, eval);
+	ASSERT_TRUE(fourth && !fourth->is_numeric());
+	EXPECT_NE(first->root_counting(), fourth->root_counting());
+	EXPECT_TRUE(*first == *fourth);
+}
+
+TEST(RealAlgebraicNumber, AlgebraicSubstitutionStrategy)
+{
+	using MPoly = MultivariatePolynomial<Rational>;
+	using UMPoly = UnivariatePolynomial<MPoly>;
+	using ran::interval::AlgebraicSubstitutionStrategy;
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	Variable v = freshRealVariable("v");
+	// v - (x + y) with x^2 - 2 and y^2 - 3
+	UMPoly p(v, {-(MPoly(x) + MPoly(y)), MPoly(1)});
+	std::vector<UMPoly> defining = {
+		UMPoly(x, {MPoly(-2), MPoly(0), MPoly(1)}),
+		UMPoly(y, {MPoly(-3), MPoly(0), MPoly(1)})
+	};
+
+	auto features = ran::interval::algsubs::features(p, defining);
+	EXPECT_EQ(2, features.algebraic_variables);
+	EXPECT_EQ(4, features.degree_product);
+	EXPECT_EQ(1, features.max_degree);
+	EXPECT_EQ(AlgebraicSubstitutionStrategy::RESULTANT, ran::interval::algsubs::select_strategy(features));
+	features.max_coefficient_bits = 1000;
+	EXPECT_EQ(AlgebraicSubstitutionStrategy::GROEBNER, ran::interval::algsubs::select_strategy(features));
+	features.algebraic_variables = 1;
+	EXPECT_EQ(AlgebraicSubstitutionStrategy::RESULTANT, ran::interval::algsubs::select_strategy(features));
+	defining.emplace_back(z, std::initializer_list<MPoly>{MPoly(-5), MPoly(0), MPoly(1)});
+	EXPECT_EQ(AlgebraicSubstitutionStrategy::GROEBNER, ran::interval::algsubs::select_strategy(ran::interval::algsubs::features(p, defining)));
+	defining.pop_back();
+
+	// (v^2 - 5)^2 - 24 has the root sqrt(2) + sqrt(3).
+	UnivariatePolynomial<Rational> expected(v, {1, 0, -10, 0, 1});
+	auto resultant = ran::interval::algebraic_substitution(p, defining, AlgebraicSubstitutionStrategy::RESULTANT);
+	ASSERT_TRUE(resultant);
+	EXPECT_EQ(expected.normalized(), resultant->normalized());
+	for (auto strategy: {AlgebraicSubstitutionStrategy::ADAPTIVE, AlgebraicSubstitutionStrategy::RACE}) {
+		auto res = ran::interval::algebraic_substitution(p, defining, strategy);
+		ASSERT_TRUE(res);
+		EXPECT_EQ(*resultant, *res) << strategy;
+	}
+}
@@ -3,7 +3,10 @@
 
 #include <carl/ran/real_roots.h>
 #include <carl/core/UnivariatePolynomial.h>
+#include <carl/core/polynomialfunctions/AberthRootApproximation.h>
 #include <carl/core/polynomialfunctions/Chebyshev.h>
+#include <carl/core/polynomialfunctions/CoprimePart.h>
+#include <carl/ran/interval/AssignmentPrefixCache.h>
 #include <carl/ran/interval/LazardEvaluation.h>
 
 #include <carl/formula/Formula.h>
@@ -150,4 +153,187 @@ TEST(RootFinder, FactorizationBug)
 		auto res = carl::model::evaluate(f, m);
 		EXPECT_TRUE(res.asBool());
 	}
-}
\ No newline at end of file
+}
+
+TEST(RootFinder, IsolationMethods)
+{
+	carl::Variable x = carl::freshRealVariable("x");
+	std::vector<Poly> polys;
+	polys.emplace_back(carl::Chebyshev<mpq_class>(x)(30));
+	// Rational roots that are hit by bisection.
+	polys.emplace_back(Poly(x, {2,-7,7,-2}));
+	// Wilkinson polynomial
+	Poly wilkinson(x, {1});
+	for (int i = 1; i <= 20; ++i) wilkinson *= Poly(x, {-i, 1});
+	polys.emplace_back(wilkinson);
+	// Mignotte-like polynomial with two close roots
+	polys.emplace_back(Poly(x, {-1, 200, -10000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1}));
+	polys.emplace_back(Poly(x, {-2, 0, 1}) * Poly(x, {-3, 0, 1}) * Poly(x, {0, 1}));
+
+	std::vector<carl::Interval<mpq_class>> intervals = {
+		carl::Interval<mpq_class>::unboundedInterval(),
+		carl::Interval<mpq_class>(mpq_class(1), carl::BoundType::WEAK, mpq_class(3), carl::BoundType::STRICT),
+		carl::Interval<mpq_class>(mpq_class(-1, 3), carl::BoundType::STRICT, mpq_class(7, 2), carl::BoundType::WEAK),
+	};
+	for (const auto& p: polys) {
+		for (const auto& i: intervals) {
+			auto expected = carl::real_roots(p, i).roots();
+			for (auto method: {carl::ran::RootIsolationMethod::DESCARTES, carl::ran::RootIsolationMethod::CONTINUED_FRACTIONS}) {
+				auto roots = carl::real_roots(p, i, method).roots();
+				EXPECT_EQ(expected, roots) << p << " in " << i << " by " << method;
+			}
+		}
+	}
+}
+
+TEST(RootFinder, AberthApproximation)
+{
+	carl::Variable x = carl::freshRealVariable("x");
+	// Roots k * 10^20, the coefficients do not fit into doubles.
+	Poly large(x, {1});
+	mpq_class scale = carl::pow(mpq_class(10), 20);
+	for (int k = 1; k <= 35; ++k) large *= Poly(x, {mpq_class(-k) * scale, mpq_class(1)});
+
+	auto approx = carl::roots::aberth::root_approximation(large);
+	EXPECT_EQ(approx.size(), 35);
+	for (int k = 1; k <= 35; ++k) {
+		long double root = (long double)k * 1e20L;
+		EXPECT_TRUE(std::any_of(approx.begin(), approx.end(), [root](const auto& a){ return std::abs(a.value - root) <= a.radius; })) << root;
+	}
+
+	std::vector<Poly> polys;
+	polys.emplace_back(large);
+	polys.emplace_back(carl::Chebyshev<mpq_class>(x)(50) * carl::pow(mpq_class(10), 400));
+	// Two clusters of close roots
+	polys.emplace_back(Poly(x, {-1, 200, -10000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1}) * Poly(x, {mpq_class(-1,1000000), 0, 1}));
+	for (const auto& p: polys) {
+		auto roots = carl::real_roots(p, carl::Interval<mpq_class>::unboundedInterval(), carl::ran::RootIsolationMethod::BISECTION).roots();
+		auto expected = carl::real_roots(p, carl::Interval<mpq_class>::unboundedInterval(), carl::ran::RootIsolationMethod::DESCARTES).roots();
+		EXPECT_EQ(expected, roots) << p;
+	}
+	auto roots = carl::real_roots(large).roots();
+	ASSERT_EQ(roots.size(), 35);
+	for (int k = 1; k <= 35; ++k) {
+		EXPECT_TRUE(represents(roots[std::size_t(k - 1)], mpq_class(k) * scale));
+	}
+}
+
+TEST(RootFinder, BatchRealRoots)
+{
+	carl::Variable x = carl::freshRealVariable("x");
+	carl::Variable y = carl::freshRealVariable("y");
+	// (x^2-2)(x-1), (x^2-2)^2 (x+1), x-1, 0, 3
+	std::vector<Poly> polys;
+	polys.emplace_back(Poly(x, {-2, 0, 1}) * Poly(x, {-1, 1}));
+	polys.emplace_back(Poly(x, {-2, 0, 1}) * Poly(x, {-2, 0, 1}) * Poly(x, {1, 1}));
+	polys.emplace_back(Poly(x, {-1, 1}));
+	polys.emplace_back(Poly(x));
+	polys.emplace_back(Poly(x, {3}));
+
+	auto basis = carl::coprime_basis(polys);
+	EXPECT_EQ(3, basis.size());
+	for (std::size_t i = 0; i < basis.size(); ++i) {
+		for (std::size_t j = i + 1; j < basis.size(); ++j) {
+			EXPECT_TRUE(carl::gcd(basis[i].first, basis[j].first).isConstant());
+		}
+	}
+
+	for (std::size_t threads: {1, 4}) {
+		auto res = carl::batch_real_roots(polys, carl::Interval<mpq_class>::unboundedInterval(), carl::ran::RootIsolationMethod::BISECTION, threads);
+		EXPECT_EQ(std::vector<std::size_t>({3}), res.nullified);
+		ASSERT_EQ(4, res.roots.size());
+		std::vector<std::vector<std::size_t>> origins = {{0, 1}, {1}, {0, 2}, {0, 1}};
+		for (std::size_t i = 0; i < res.roots.size(); ++i) {
+			EXPECT_EQ(origins[i], res.roots[i].second);
+			for (auto o: res.roots[i].second) {
+				auto expected = carl::real_roots(polys[o]).roots();
+				EXPECT_NE(expected.end(), std::find(expected.begin(), expected.end(), res.roots[i].first));
+			}
+		}
+	}
+
+	{
+		// x^2 - y and x - 1 share the root 1 at y = 1, x^2 - y and x^2 - z coincide at y = z = 4.
+		// x^2 - z is not univariate unless z is assigned, (y - 1) x is nullified at y = 1.
+		carl::Variable z = carl::freshRealVariable("z");
+		std::vector<UMPolynomial> upolys;
+		upolys.emplace_back(x, std::initializer_list<MPolynomial>{-MPolynomial(y), MPolynomial(0), MPolynomial(1)});
+		upolys.emplace_back(x, std::initializer_list<MPolynomial>{MPolynomial(-1), MPolynomial(1)});
+		upolys.emplace_back(x, std::initializer_list<MPolynomial>{-MPolynomial(z), MPolynomial(0), MPolynomial(1)});
+		upolys.emplace_back(x, std::initializer_list<MPolynomial>{MPolynomial(0), MPolynomial(y) - MPolynomial(1)});
+		std::map<carl::Variable, carl::RealAlgebraicNumber<Rational>> m;
+		m.emplace(y, carl::RealAlgebraicNumber<Rational>(Rational(1)));
+		auto res = carl::batch_real_roots(upolys, m);
+		EXPECT_EQ(std::vector<std::size_t>({2}), res.non_univariate);
+		EXPECT_EQ(std::vector<std::size_t>({3}), res.nullified);
+		ASSERT_EQ(2, res.roots.size());
+		EXPECT_TRUE(represents(res.roots[0].first, Rational(-1)));
+		EXPECT_EQ(std::vector<std::size_t>({0}), res.roots[0].second);
+		EXPECT_TRUE(represents(res.roots[1].first, Rational(1)));
+		EXPECT_EQ(std::vector<std::size_t>({0, 1}), res.roots[1].second);
+
+		m[y] = carl::RealAlgebraicNumber<Rational>(Rational(4));
+		m[z] = carl::RealAlgebraicNumber<Rational>(Rational(4));
+		res = carl::batch_real_roots(upolys, m);
+		EXPECT_TRUE(res.non_univariate.empty());
+		EXPECT_TRUE(res.nullified.empty());
+		ASSERT_EQ(4, res.roots.size());
+		std::vector<std::vector<std::size_t>> origins = {{0, 2}, {3}, {1}, {0, 2}};
+		std::vector<Rational> values = {-2, 0, 1, 2};
+		for (std::size_t i = 0; i < res.roots.size(); ++i) {
+			EXPECT_EQ(origins[i], res.roots[i].second);
+			EXPECT_TRUE(represents(res.roots[i].first, values[i]));
+		}
+	}
+}
+
+TEST(RootFinder, AssignmentPrefixCache)
+{
+	carl::Variable x = carl::freshRealVariable("x");
+	carl::Variable y = carl::freshRealVariable("y");
+	carl::Variable z = carl::freshRealVariable("z");
+	auto sqrt2 = carl::real_roots(UPolynomial(x, {-2, 0, 1})).roots().back();
+	// z^2 - x*y
+	UMPolynomial p(z, {-MPolynomial(x) * MPolynomial(y), MPolynomial(0), MPolynomial(1)});
+
+	carl::ran::interval::AssignmentPrefixCache<Rational> cache;
+	for (int i = -2; i <= 3; ++i) {
+		Rational value = Rational(i) / 2;
+		cache.assign({{x, sqrt2}, {y, carl::RealAlgebraicNumber<Rational>(value)}});
+		auto roots = carl::real_roots(p, cache);
+		ASSERT_TRUE(roots.is_univariate());
+		// z^2 = sqrt(2) y implies z^4 = 2 y^2
+		std::vector<carl::RealAlgebraicNumber<Rational>> expected;
+		if (value > 0) {
+			expected = carl::real_roots(UPolynomial(z, {Rational(-2 * value * value), 0, 0, 0, 1})).roots();
+		} else if (value == 0) {
+			expected.emplace_back(Rational(0));
+		}
+		EXPECT_EQ(expected, roots.roots()) << "y = " << value;
+		// The substitution of x = sqrt(2) is computed once and reused for every value of y.
+		EXPECT_EQ(std::size_t(i + 2), cache.reused_levels()) << "y = " << value;
+		EXPECT_EQ(std::size_t(i + 4), cache.computed_levels()) << "y = " << value;
+	}
+
+	cache.assign({{x, sqrt2}, {y, sqrt2}});
+	auto roots = carl::real_roots(p, cache);
+	EXPECT_EQ(6, cache.reused_levels());
+	EXPECT_EQ(8, cache.computed_levels());
+	ASSERT_TRUE(roots.is_univariate());
+	ASSERT_EQ(2, roots.roots().size());
+	EXPECT_EQ(sqrt2, roots.roots().back());
+
+	auto product = carl::evaluate(MPolynomial(x) * MPolynomial(y), cache);
+	ASSERT_TRUE(product);
+	EXPECT_EQ(carl::RealAlgebraicNumber<Rational>(Rational(2)), *product);
+	auto sum = carl::evaluate(MPolynomial(x) + MPolynomial(y), cache);
+	ASSERT_TRUE(sum);
+	EXPECT_TRUE(*sum > carl::RealAlgebraicNumber<Rational>(Rational(2)));
+	EXPECT_TRUE(*sum < carl::RealAlgebraicNumber<Rational>(Rational(3)));
+	EXPECT_TRUE(carl::evaluate(carl::Constraint<MPolynomial>(MPolynomial(x) * MPolynomial(y) - Rational(2), carl::Relation::EQ), cache));
+	EXPECT_FALSE(carl::evaluate(carl::Constraint<MPolynomial>(MPolynomial(x) + MPolynomial(y) - Rational(2), carl::Relation::LEQ), cache));
+
+	// An unassigned variable remains.
+	cache.assign({{x, sqrt2}});
+	EXPECT_TRUE(carl::real_roots(p, cache).is_non_univariate());
+}
@@ -7,7 +7,9 @@
 #include "carl/core/polynomialfunctions/Resultant.h"
 #include "carl/core/polynomialfunctions/Factorization_univariate.h"
 #include "carl/core/polynomialfunctions/Derivative.h"
+#include "carl/core/polynomialfunctions/Evaluation.h"
 #include "carl/core/polynomialfunctions/Representation.h"
+#include "carl/core/polynomialfunctions/TaylorShift.h"
 #include "carl/core/UnivariatePolynomial.h"
 #include "carl/core/VariablePool.h"
 
@@ -501,3 +503,23 @@ TEST(UnivariatePolynomial, coprimeFactor)
 
 	ASSERT_EQ(carl::getDenom(pol.coprimeFactor()), 1);
 }
+
+TEST(UnivariatePolynomial, TaylorShift)
+{
+	Variable x = freshRealVariable("x");
+	std::mt19937 rand(4);
+	std::uniform_int_distribution<int> coefficient(-100, 100);
+	// Cover both the classical and the divide and conquer shift.
+	for (std::size_t degree: {0, 1, 5, 63, 64, 150}) {
+		std::vector<mpq_class> coeffs;
+		for (std::size_t i = 0; i <= degree; ++i) coeffs.emplace_back(coefficient(rand));
+		UnivariatePolynomial<mpq_class> p(x, coeffs);
+		for (mpq_class a: {mpq_class(1), mpq_class(-3), mpq_class(2, 7)}) {
+			UnivariatePolynomial<mpq_class> shifted = taylor_shift(p, a);
+			EXPECT_EQ(p.degree(), shifted.degree());
+			for (mpq_class v: {mpq_class(0), mpq_class(1), mpq_class(-5, 3)}) {
+				EXPECT_EQ(carl::evaluate(p, mpq_class(v + a)), carl::evaluate(shifted, v));
+			}
+		}
+	}
+}
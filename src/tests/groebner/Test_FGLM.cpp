@@ -0,0 +1,95 @@
+#include "gtest/gtest.h"
+
+#include "carl/groebner/groebner.h"
+#include "carl/groebner/RealSolutions.h"
+
+#include "../Common.h"
+
+using namespace carl;
+
+using GrLexPoly = MultivariatePolynomial<Rational, GrLexOrdering>;
+using LexPoly = MultivariatePolynomial<Rational, LexOrdering>;
+
+template<typename Poly>
+std::vector<Poly> reducedBasis(const std::vector<Poly>& input)
+{
+	GBProcedure<Poly, Buchberger, StdAdding> gb;
+	for (const auto& p: input) gb.addPolynomial(p.normalize());
+	gb.reduceInput();
+	gb.calculate();
+	return gb.getIdeal().getGenerators();
+}
+
+TEST(FGLM, Conversion)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	GrLexPoly gx(x);
+	GrLexPoly gy(y);
+
+	GBProcedure<GrLexPoly, Buchberger, StdAdding> gb;
+	gb.addPolynomial((gx*gx + gy*gy - Rational(5)).normalize());
+	gb.addPolynomial((gx*gy - Rational(2)).normalize());
+	gb.reduceInput();
+	gb.calculate();
+
+	FGLM<GrLexPoly, LexPoly> fglm(gb.getIdeal());
+	ASSERT_TRUE(fglm.isZeroDimensional());
+	EXPECT_EQ(4, fglm.dimension());
+	std::vector<LexPoly> lex = fglm.convert();
+
+	LexPoly lx(x);
+	LexPoly ly(y);
+	std::vector<LexPoly> expected = reducedBasis<LexPoly>({ lx*lx + ly*ly - Rational(5), lx*ly - Rational(2) });
+	std::sort(expected.begin(), expected.end());
+	std::sort(lex.begin(), lex.end());
+	EXPECT_EQ(expected, lex);
+	// The basis contains a univariate polynomial in the least significant variable.
+	LexPoly univariate = lx*lx*lx*lx - Rational(5)*lx*lx + Rational(4);
+	EXPECT_NE(lex.end(), std::find(lex.begin(), lex.end(), univariate));
+}
+
+TEST(FGLM, NotZeroDimensional)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	GBProcedure<GrLexPoly, Buchberger, StdAdding> gb;
+	gb.addPolynomial(GrLexPoly(x) * GrLexPoly(y) - Rational(1));
+	gb.calculate();
+	FGLM<GrLexPoly, LexPoly> fglm(gb.getIdeal());
+	EXPECT_FALSE(fglm.isZeroDimensional());
+}
+
+TEST(FGLM, RealSolutions)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	GrLexPoly gx(x);
+	GrLexPoly gy(y);
+
+	GBProcedure<GrLexPoly, Buchberger, StdAdding> gb;
+	gb.addPolynomial((gx*gx + gy*gy - Rational(5)).normalize());
+	gb.addPolynomial((gx*gy - Rational(2)).normalize());
+	gb.calculate();
+
+	auto solutions = real_solutions<Rational>(gb.getIdeal());
+	ASSERT_EQ(4, solutions.size());
+	for (const auto& s: solutions) {
+		ASSERT_EQ(2, s.size());
+		ASSERT_TRUE(s.at(x).is_numeric());
+		ASSERT_TRUE(s.at(y).is_numeric());
+		EXPECT_EQ(Rational(2), s.at(x).value() * s.at(y).value());
+		EXPECT_EQ(Rational(5), s.at(x).value() * s.at(x).value() + s.at(y).value() * s.at(y).value());
+	}
+
+	// y^2 = x has no real solution for x = -1.
+	GBProcedure<GrLexPoly, Buchberger, StdAdding> gb2;
+	gb2.addPolynomial(gx*gx - Rational(1));
+	gb2.addPolynomial(gy*gy - gx);
+	gb2.calculate();
+	auto solutions2 = real_solutions<Rational>(gb2.getIdeal());
+	ASSERT_EQ(2, solutions2.size());
+	for (const auto& s: solutions2) {
+		EXPECT_EQ(Rational(1), s.at(x).value());
+	}
+}
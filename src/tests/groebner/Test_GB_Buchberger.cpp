@@ -76,3 +76,198 @@ TEST(GB_Buchberger, T1_ReasonSets)
     EXPECT_EQ(x,gb2object.getIdeal().getGenerator(0));
     EXPECT_EQ(y,gb2object.getIdeal().getGenerator(1));
 }
+
+TEST(GB_Buchberger, PushPop)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+
+    MultivariatePolynomial<Rational> f1({(Rational)1*x*x*x, (Rational)-2*x*y} );
+    MultivariatePolynomial<Rational> f2({(Rational)1*x*x*y, (Rational)-2*y*y, (Rational)1*x});
+    MultivariatePolynomial<Rational> F1({(Rational)1*x*x} );
+    MultivariatePolynomial<Rational> F2({(Rational)1*y*y, (Rational)-1*(Rational)1/(Rational)2*x} );
+    MultivariatePolynomial<Rational> F3({(Rational)1*x*y} );
+    GBProcedure<MultivariatePolynomial<Rational>, Buchberger, StdAdding> gbobject;
+    gbobject.addPolynomial(f1);
+    gbobject.calculate();
+    std::vector<MultivariatePolynomial<Rational>> basis = gbobject.getBasisPolynomials();
+    EXPECT_EQ(1, basis.size());
+
+    gbobject.push();
+    EXPECT_EQ(1, gbobject.nrCheckpoints());
+    gbobject.addPolynomial(f2);
+    gbobject.calculate();
+    EXPECT_EQ(3, gbobject.getIdeal().nrGenerators());
+    EXPECT_EQ(F1,gbobject.getIdeal().getGenerator(0));
+    EXPECT_EQ(F3,gbobject.getIdeal().getGenerator(1));
+    EXPECT_EQ(F2,gbobject.getIdeal().getGenerator(2));
+
+    gbobject.push();
+    gbobject.addPolynomial(MultivariatePolynomial<Rational>(x) + Rational(1));
+    gbobject.calculate();
+    EXPECT_TRUE(gbobject.basisIsConstant());
+    gbobject.pop();
+    EXPECT_EQ(2, gbobject.nrOrigGenerators());
+    EXPECT_EQ(3, gbobject.getIdeal().nrGenerators());
+
+    gbobject.pop();
+    EXPECT_EQ(0, gbobject.nrCheckpoints());
+    EXPECT_EQ(1, gbobject.nrOrigGenerators());
+    EXPECT_EQ(basis, gbobject.getBasisPolynomials());
+
+    // Recomputing after backtracking yields the same basis again.
+    gbobject.addPolynomial(f2);
+    gbobject.calculate();
+    EXPECT_EQ(F1,gbobject.getIdeal().getGenerator(0));
+    EXPECT_EQ(F3,gbobject.getIdeal().getGenerator(1));
+    EXPECT_EQ(F2,gbobject.getIdeal().getGenerator(2));
+}
+
+TEST(GB_Buchberger, CopyCheckpoints)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+
+    MultivariatePolynomial<Rational> f1({(Rational)1*x*x*x, (Rational)-2*x*y} );
+    MultivariatePolynomial<Rational> f2({(Rational)1*x*x*y, (Rational)-2*y*y, (Rational)1*x});
+    MultivariatePolynomial<Rational> F1({(Rational)1*x*x} );
+    MultivariatePolynomial<Rational> F2({(Rational)1*y*y, (Rational)-1*(Rational)1/(Rational)2*x} );
+    MultivariatePolynomial<Rational> F3({(Rational)1*x*y} );
+    using GB = GBProcedure<MultivariatePolynomial<Rational>, Buchberger, StdAdding>;
+    GB gbobject;
+    gbobject.addPolynomial(f1);
+    gbobject.calculate();
+    std::vector<MultivariatePolynomial<Rational>> basis = gbobject.getBasisPolynomials();
+    gbobject.push();
+    gbobject.push();
+
+    GB copy(gbobject);
+    GB assigned;
+    assigned = gbobject;
+    EXPECT_EQ(2, copy.nrCheckpoints());
+    EXPECT_EQ(2, assigned.nrCheckpoints());
+
+    // Backtracking and calculating on the copies does not affect the original.
+    for (GB* gb: {&copy, &assigned}) {
+        gb->pop();
+        gb->addPolynomial(MultivariatePolynomial<Rational>(x) + Rational(1));
+        gb->calculate();
+        EXPECT_EQ(2, gb->getBasisPolynomials().size());
+        EXPECT_EQ(basis, gbobject.getBasisPolynomials());
+        gb->pop();
+        EXPECT_EQ(basis, gb->getBasisPolynomials());
+    }
+
+    // Backtracking and calculating on the original does not affect the copies.
+    copy.addPolynomial(MultivariatePolynomial<Rational>(y) + Rational(1));
+    copy.calculate();
+    std::vector<MultivariatePolynomial<Rational>> copyBasis = copy.getBasisPolynomials();
+    gbobject.pop();
+    gbobject.addPolynomial(f2);
+    gbobject.calculate();
+    EXPECT_EQ(F1,gbobject.getIdeal().getGenerator(0));
+    EXPECT_EQ(F3,gbobject.getIdeal().getGenerator(1));
+    EXPECT_EQ(F2,gbobject.getIdeal().getGenerator(2));
+    gbobject.pop();
+    EXPECT_EQ(basis, gbobject.getBasisPolynomials());
+    EXPECT_EQ(copyBasis, copy.getBasisPolynomials());
+    EXPECT_EQ(basis, assigned.getBasisPolynomials());
+}
+
+/// Exposes the sugar degrees of the generators.
+template<typename Polynomial>
+struct SugarProbe: Buchberger<Polynomial, StdAdding>
+{
+	using Buchberger<Polynomial, StdAdding>::sugar;
+};
+
+TEST(GB_Buchberger, Sugar)
+{
+	using Poly = MultivariatePolynomial<Rational>;
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	SugarProbe<Poly> probe;
+	probe.setPairSelectionStrategy(PairSelectionStrategy::SUGAR);
+	auto ideal = std::make_shared<Ideal<Poly>>();
+	probe.setIdeal(ideal);
+	probe.calculate({
+		Poly({(Rational)1*x*x*y, (Rational)-1*z, (Rational)1*x}),
+		Poly({(Rational)1*x*y*y, (Rational)-1*x, Term<Rational>(1)})
+	});
+	// The sugar of the generators added by the S-pairs exceeds their degree.
+	bool exceeds = false;
+	for (std::size_t i = 0; i < ideal->nrGenerators(); ++i) {
+		EXPECT_GE(probe.sugar(i), ideal->getGenerator(i).totalDegree());
+		exceeds = exceeds || probe.sugar(i) > ideal->getGenerator(i).totalDegree();
+	}
+	EXPECT_TRUE(exceeds);
+
+	// Removing eliminated generators reindexes them, hence the sugar of the previous call is discarded.
+	ideal->removeEliminated();
+	std::size_t before = ideal->nrGenerators();
+	probe.calculate({Poly({(Rational)1*x*y*z, (Rational)-1*y*y})});
+	for (std::size_t i = 0; i < before; ++i) {
+		EXPECT_EQ(probe.sugar(i), ideal->getGenerator(i).totalDegree()) << ideal->getGenerator(i);
+	}
+
+	// Replacing the ideal discards the sugar as well.
+	auto replaced = std::make_shared<Ideal<Poly>>();
+	replaced->addGenerator(Poly(x) + Rational(1));
+	probe.setIdeal(replaced);
+	EXPECT_EQ(1, probe.sugar(0));
+}
+
+TEST(GB_Buchberger, PairSelection)
+{
+	using Poly = MultivariatePolynomial<Rational>;
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	// Not homogeneous
+	std::vector<Poly> inhom = {
+		Poly({(Rational)1*x*x*y, (Rational)-1*z, (Rational)1*x}),
+		Poly({(Rational)1*x*y*y, (Rational)-1*x, Term<Rational>(1)}),
+		Poly({(Rational)1*x*y*z, (Rational)-1*y*y})
+	};
+	// Homogeneous
+	std::vector<Poly> hom = {
+		Poly({(Rational)1*x*x*y, (Rational)-1*z*z*z}),
+		Poly({(Rational)1*x*y*y, (Rational)-1*x*z*z}),
+		Poly({(Rational)1*x*y*z, (Rational)-1*y*y*z})
+	};
+	for (const auto& input: {inhom, hom}) {
+		auto gb = [&input](PairSelectionStrategy strategy) {
+			GBProcedure<Poly, Buchberger, StdAdding> gbobject;
+			gbobject.setPairSelectionStrategy(strategy);
+			for (const auto& p: input) gbobject.addPolynomial(p.normalize());
+			gbobject.calculate();
+			std::vector<Poly> res = gbobject.getIdeal().getGenerators();
+			std::sort(res.begin(), res.end());
+			return res;
+		};
+		auto expected = gb(PairSelectionStrategy::NORMAL);
+		EXPECT_EQ(expected, gb(PairSelectionStrategy::SUGAR));
+		EXPECT_EQ(expected, gb(PairSelectionStrategy::DOUBLESUGAR));
+		EXPECT_EQ(expected, gb(PairSelectionStrategy::HOMOGENIZATION_AWARE));
+	}
+}
+
+TEST(GB_Buchberger, CriticalPairsMemory)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	CritPairs pairs;
+	EXPECT_EQ(0, pairs.size());
+	std::size_t empty = pairs.getMemoryUse();
+	pairs.push({SPolPair(0, 1, createMonomial(x, 2))});
+	std::size_t single = pairs.getMemoryUse();
+	EXPECT_GT(single, empty);
+	// The queued pairs are counted, not only the index of the heap.
+	std::list<SPolPair> many;
+	for (std::size_t i = 0; i < 100; ++i) many.emplace_back(i, i + 1, createMonomial(y, exponent(i + 1)));
+	pairs.push(std::move(many));
+	EXPECT_EQ(2, pairs.size());
+	EXPECT_GE(pairs.getMemoryUse(), single + 100 * sizeof(SPolPair));
+	while (!pairs.empty()) pairs.pop();
+}
@@ -1,5 +1,7 @@
 #include "gtest/gtest.h"
 #include "carl/groebner/Reductor.h"
+#include "carl/groebner/groebner.h"
+#include "carl/groebner/benchmarks/katsura.h"
 #include "carl/util/platform.h"
 
 #include "../Common.h"
@@ -50,3 +52,31 @@ TEST(Reductor, Reduction)
     fres = reductor4.fullReduce();
     EXPECT_EQ((Rational)-1 * z, fres);
 }
+
+template<template <class> class Datastructure, template <typename> class Configuration>
+MultivariatePolynomial<Rational> reduceWith(const Ideal<MultivariatePolynomial<Rational>>& ideal, const MultivariatePolynomial<Rational>& f)
+{
+    Reductor<MultivariatePolynomial<Rational>, MultivariatePolynomial<Rational>, Datastructure, Configuration> reductor(ideal, f);
+    return reductor.fullReduce();
+}
+
+TEST(Reductor, Datastructures)
+{
+    using Poly = MultivariatePolynomial<Rational>;
+    std::vector<Poly> input = benchmarks::katsura<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(4);
+    GBProcedure<Poly, Buchberger, StdAdding> gbobject;
+    for (const auto& p: input) gbobject.addPolynomial(p.normalize());
+    gbobject.calculate();
+    const Ideal<Poly>& ideal = gbobject.getIdeal();
+
+    for (const auto& p: input) {
+        for (const auto& q: input) {
+            Poly f = p * q * q + q;
+            Poly expected = reduceWith<Heap, ReductorConfiguration>(ideal, f);
+            EXPECT_EQ(expected, (reduceWith<Geobucket, ReductorConfiguration>(ideal, f)));
+            EXPECT_EQ(expected, (reduceWith<Geobucket, DeduplicatingReductorConfiguration>(ideal, f)));
+            EXPECT_EQ(expected, (reduceWith<TourTree, ReductorConfiguration>(ideal, f)));
+            EXPECT_EQ(expected, (reduceWith<TourTree, DeduplicatingReductorConfiguration>(ideal, f)));
+        }
+    }
+}
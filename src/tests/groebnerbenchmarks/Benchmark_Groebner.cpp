@@ -0,0 +1,129 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/groebner/groebner.h>
+#include <carl/groebner/benchmarks/cyclic.h>
+#include <carl/groebner/benchmarks/katsura.h>
+#include <carl/groebner/benchmarks/random.h>
+#include <carl/groebner/gb-buchberger/BuchbergerStats.h>
+
+#include <map>
+#include <sstream>
+
+/**
+ * Groebner basis computations on the standard benchmark families.
+ * Besides the time, the statistics from BuchbergerStats are reported as counters:
+ * - spairs: S-pairs that were reduced,
+ * - zero_reductions: S-pairs that reduced to zero,
+ * - scheduled_spairs: S-pairs that survived the criteria when they were created,
+ * - peak_pair_queue_memory: peak memory of the critical pairs queue in bytes, i.e. the heap and all queued pairs, but neither the basis nor the monomials the pairs share with it,
+ * - max_sugar: largest sugar degree of a treated S-pair,
+ * - basis_size: number of generators of the resulting basis.
+ * The second argument selects the PairSelectionStrategy, its name is given as label.
+ * Use the groebner-benchmarks target or --benchmark_out_format=json to obtain the results as JSON.
+ */
+
+enum class GroebnerFamily { Cyclic, Katsura, RandomDense, RandomSparse };
+
+template<typename Ordering>
+using GroebnerPoly = carl::MultivariatePolynomial<mpq_class, Ordering, carl::StdMultivariatePolynomialPolicies<>>;
+
+template<typename Ordering>
+const std::vector<GroebnerPoly<Ordering>>& groebner_workload(GroebnerFamily family, unsigned size) {
+	static std::map<std::pair<GroebnerFamily,unsigned>, std::vector<GroebnerPoly<Ordering>>> cache;
+	auto it = cache.find(std::make_pair(family, size));
+	if (it != cache.end()) return it->second;
+
+	std::vector<GroebnerPoly<Ordering>> input;
+	switch (family) {
+		case GroebnerFamily::Cyclic:
+			input = carl::benchmarks::cyclic<mpq_class, Ordering, carl::StdMultivariatePolynomialPolicies<>>(size);
+			break;
+		case GroebnerFamily::Katsura:
+			input = carl::benchmarks::katsura<mpq_class, Ordering, carl::StdMultivariatePolynomialPolicies<>>(size);
+			break;
+		case GroebnerFamily::RandomDense:
+			input = carl::benchmarks::random_ideal<mpq_class, Ordering, carl::StdMultivariatePolynomialPolicies<>>(size, size, 2, 0, size);
+			break;
+		case GroebnerFamily::RandomSparse:
+			input = carl::benchmarks::random_ideal<mpq_class, Ordering, carl::StdMultivariatePolynomialPolicies<>>(size, size, 3, 4, size);
+			break;
+	}
+	for (auto& p: input) p = p.normalize();
+	return cache.emplace(std::make_pair(family, size), std::move(input)).first->second;
+}
+
+template<typename Ordering, GroebnerFamily Family>
+void BM_Groebner(benchmark::State& state) {
+	const auto& input = groebner_workload<Ordering>(Family, unsigned(state.range(0)));
+	auto strategy = carl::PairSelectionStrategy(state.range(1));
+	carl::BuchbergerStats* stats = carl::BuchbergerStats::getInstance();
+	stats->reset();
+	std::size_t basisSize = 0;
+	for (auto _ : state) {
+		carl::GBProcedure<GroebnerPoly<Ordering>, carl::Buchberger, carl::StdAdding> gb;
+		gb.setPairSelectionStrategy(strategy);
+		for (const auto& p: input) gb.addPolynomial(p);
+		gb.calculate();
+		basisSize = gb.getIdeal().nrGenerators();
+	}
+	double iterations = double(state.iterations());
+	state.counters["spairs"] = stats->getNrReductions() / iterations;
+	state.counters["zero_reductions"] = stats->getNrZeroReductions() / iterations;
+	state.counters["scheduled_spairs"] = double(stats->getNrScheduledSPairs()) / iterations;
+	state.counters["peak_pair_queue_memory"] = double(stats->getPeakCriticalPairsMemory());
+	state.counters["max_sugar"] = double(stats->getMaxSugar());
+	state.counters["basis_size"] = double(basisSize);
+	std::stringstream ss;
+	ss << strategy << " (" << stats->getPairSelectionStrategy() << ")";
+	state.SetLabel(ss.str());
+}
+
+template<int From, int To>
+void GroebnerSizes(benchmark::internal::Benchmark* b) {
+	b->ArgNames({"size", "strategy"});
+	for (int strategy = int(carl::PairSelectionStrategy::NORMAL); strategy <= int(carl::PairSelectionStrategy::HOMOGENIZATION_AWARE); ++strategy) {
+		for (int size = From; size <= To; ++size) b->Args({size, strategy});
+	}
+}
+
+#define GROEBNER_BENCHMARKS(ORDERING) \
+	BENCHMARK_TEMPLATE(BM_Groebner, carl::ORDERING, GroebnerFamily::Cyclic)->Apply(GroebnerSizes<4, 8>)->Unit(benchmark::kMillisecond); \
+	BENCHMARK_TEMPLATE(BM_Groebner, carl::ORDERING, GroebnerFamily::Katsura)->Apply(GroebnerSizes<4, 10>)->Unit(benchmark::kMillisecond); \
+	BENCHMARK_TEMPLATE(BM_Groebner, carl::ORDERING, GroebnerFamily::RandomDense)->Apply(GroebnerSizes<2, 4>)->Unit(benchmark::kMillisecond); \
+	BENCHMARK_TEMPLATE(BM_Groebner, carl::ORDERING, GroebnerFamily::RandomSparse)->Apply(GroebnerSizes<2, 4>)->Unit(benchmark::kMillisecond)
+
+GROEBNER_BENCHMARKS(GrLexOrdering);
+// Lexicographic bases suffer from much larger coefficients and degrees, hence only small instances are feasible:
+// katsura 4 does not finish within ten minutes while its graded basis takes about a millisecond.
+BENCHMARK_TEMPLATE(BM_Groebner, carl::LexOrdering, GroebnerFamily::Cyclic)->Apply(GroebnerSizes<4, 4>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Groebner, carl::LexOrdering, GroebnerFamily::Katsura)->Apply(GroebnerSizes<2, 3>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Groebner, carl::LexOrdering, GroebnerFamily::RandomDense)->Apply(GroebnerSizes<2, 2>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Groebner, carl::LexOrdering, GroebnerFamily::RandomSparse)->Apply(GroebnerSizes<2, 2>)->Unit(benchmark::kMillisecond);
+
+/**
+ * Lexicographic bases of zero-dimensional ideals, computed via a GrLexOrdering basis and FGLM.
+ * Computing them with Buchberger directly only finishes for small instances (see the LexOrdering benchmarks above),
+ * due to the growth of coefficients and degrees in the intermediate lexicographic bases.
+ * Counters: dimension of the quotient ring and lex_size, the size of the lexicographic basis.
+ */
+template<GroebnerFamily Family>
+void BM_FGLM(benchmark::State& state) {
+	using Source = GroebnerPoly<carl::GrLexOrdering>;
+	using Target = GroebnerPoly<carl::LexOrdering>;
+	const auto& input = groebner_workload<carl::GrLexOrdering>(Family, unsigned(state.range(0)));
+	carl::GBProcedure<Source, carl::Buchberger, carl::StdAdding> gb;
+	for (const auto& p: input) gb.addPolynomial(p);
+	gb.calculate();
+	std::size_t dimension = 0;
+	std::size_t lexSize = 0;
+	for (auto _ : state) {
+		carl::FGLM<Source, Target> fglm(gb.getIdeal());
+		dimension = fglm.dimension();
+		lexSize = fglm.convert().size();
+	}
+	state.counters["dimension"] = double(dimension);
+	state.counters["lex_size"] = double(lexSize);
+}
+BENCHMARK_TEMPLATE(BM_FGLM, GroebnerFamily::Katsura)->DenseRange(3, 6)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_FGLM, GroebnerFamily::RandomDense)->DenseRange(2, 4)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_FGLM, GroebnerFamily::RandomSparse)->DenseRange(2, 3)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <carl/core/VariablePool.h>
+#include <carl/interval/AdaptiveEvaluation.h>
+#include <carl/interval/Interval.h>
+
+#include "../number_types.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+TEST(AdaptiveEvaluation, Precision)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	std::map<Variable, Interval<Rational>> map;
+
+	// Decided with double precision.
+	Poly p = Poly(x)*Poly(x) + Rational(1);
+	map.emplace(x, Interval<Rational>(Rational(-1), Rational(1)));
+	auto res = AdaptiveEvaluation::evaluate(p, map);
+	EXPECT_EQ(Sign::POSITIVE, res.sign);
+	EXPECT_EQ(53, res.precision);
+
+	// Undecided due to the interval, not the precision.
+	p = Poly(x)*Poly(x) - Rational(2);
+	map[x] = Interval<Rational>(Rational(1), Rational(2));
+	res = AdaptiveEvaluation::evaluate(p, map);
+	EXPECT_FALSE(res.sign);
+	EXPECT_EQ(53, res.precision);
+
+	// Decided with 128 bits.
+	Rational delta = Rational(1) / carl::pow(Rational(2), 100);
+	p = Poly(x) - Rational(1, 3);
+	map[x] = Interval<Rational>(Rational(Rational(1, 3) + delta));
+	res = AdaptiveEvaluation::evaluate(p, map);
+	EXPECT_EQ(Sign::POSITIVE, res.sign);
+	EXPECT_EQ(128, res.precision);
+	EXPECT_TRUE(res.interval.contains(delta));
+	map[x] = Interval<Rational>(Rational(Rational(1, 3) - delta));
+	res = AdaptiveEvaluation::evaluate(p, map);
+	EXPECT_EQ(Sign::NEGATIVE, res.sign);
+	EXPECT_EQ(128, res.precision);
+
+	// Decided with exact arithmetic only.
+	p = Poly(x)*Poly(y) - Poly(z);
+	map[x] = Interval<Rational>(Rational(3));
+	map.emplace(y, Interval<Rational>(Rational(1, 3)));
+	map.emplace(z, Interval<Rational>(Rational(1)));
+	res = AdaptiveEvaluation::evaluate(p, map);
+	EXPECT_EQ(Sign::ZERO, res.sign);
+	EXPECT_EQ(0, res.precision);
+	res = AdaptiveEvaluation::evaluate(p, map, 256);
+	EXPECT_EQ(Sign::ZERO, res.sign);
+	EXPECT_EQ(0, res.precision);
+}
+
+TEST(AdaptiveEvaluation, Overflow)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	std::map<Variable, Interval<Rational>> map;
+
+	// The terms almost cancel, but the sum of their magnitudes exceeds the range of doubles.
+	Rational c = carl::pow(Rational(10), 308);
+	Poly p = Poly(x) * c - Poly(y) * c;
+	map.emplace(x, Interval<Rational>(Rational(1)));
+	map.emplace(y, Interval<Rational>(Rational(Rational(1) - Rational(1) / carl::pow(Rational(2), 60))));
+	auto res = AdaptiveEvaluation::evaluate(p, map);
+	EXPECT_EQ(Sign::POSITIVE, res.sign);
+	EXPECT_EQ(0, res.precision);
+}
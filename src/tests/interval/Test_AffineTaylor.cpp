@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include <carl/core/VariablePool.h>
+#include <carl/interval/AffineForm.h>
+#include <carl/interval/Interval.h>
+#include <carl/interval/IntervalBox.h>
+#include <carl/interval/IntervalEvaluation.h>
+#include <carl/interval/TaylorModel.h>
+
+#include "../number_types.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+TEST(AffineForm, Evaluation)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	IntervalBox<double> box;
+	box.insert_or_assign(x, Interval<double>(0.0, 2.0));
+	box.insert_or_assign(y, Interval<double>(-1.0, 3.0));
+
+	Poly px(x);
+	EXPECT_EQ(AffineForm<double>::evaluate(px - px, box).to_interval(), Interval<double>(0));
+
+	Poly p = px*px - Rational(2)*px;
+	EXPECT_EQ(IntervalEvaluation::evaluate(p, box), Interval<double>(-4.0, 4.0));
+	EXPECT_EQ(AffineForm<double>::evaluate(p, box).to_interval(), Interval<double>(-1.0, 0.0));
+
+	Poly q = px*px*Poly(y) - px*Poly(y) + Rational(1, 3)*Poly(y)*Poly(y);
+	Interval<double> naive = IntervalEvaluation::evaluate(q, box);
+	Interval<double> affine = AffineForm<double>::evaluate(q, box).to_interval();
+	EXPECT_LT(affine.diameter(), naive.diameter());
+	for (double vx = 0; vx <= 2; vx += 0.125) {
+		for (double vy = -1; vy <= 3; vy += 0.125) {
+			double value = vx*vx*vy - vx*vy + vy*vy/3;
+			EXPECT_TRUE(affine.contains(value)) << value << " not in " << affine;
+		}
+	}
+
+	std::map<Variable, Interval<double>> map = box.to_map();
+	EXPECT_EQ(AffineForm<double>::evaluate(q, map).to_interval(), affine);
+
+	Interval<Rational>::evalintervalmap exact;
+	exact[x] = Interval<Rational>(0, 2);
+	EXPECT_EQ(AffineForm<Rational>::evaluate(p, exact).to_interval(), Interval<Rational>(-1, 0));
+
+	// Unbounded intervals are not represented by noise symbols.
+	box.insert_or_assign(y, Interval<double>::unboundedInterval());
+	EXPECT_TRUE(AffineForm<double>::evaluate(q, box).to_interval().isInfinite());
+}
+
+TEST(TaylorModel, Evaluation)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	IntervalBox<double> box;
+	box.insert_or_assign(x, Interval<double>(0.0, 2.0));
+	box.insert_or_assign(y, Interval<double>(-1.0, 3.0));
+
+	Poly px(x);
+	Poly py(y);
+	Poly p = px*px - Rational(2)*px;
+	TaylorModel<Poly> tm(p, box, 2);
+	EXPECT_EQ(tm.expansion_point().at(x), Rational(1));
+	EXPECT_EQ(tm.polynomial(), px*px - Rational(1));
+	EXPECT_EQ(tm.remainder(), Interval<double>(0));
+	EXPECT_EQ(tm.to_interval(), Interval<double>(-1.0, 0.0));
+
+	// Terms of higher degree are moved to the remainder.
+	Poly q = carl::pow(px, 3) * py - px * py + Rational(1, 3)*py*py;
+	Interval<double> naive = IntervalEvaluation::evaluate(q, box);
+	for (std::size_t order: {1, 2, 4}) {
+		TaylorModel<Poly> model(q, box, order);
+		EXPECT_LE(model.polynomial().totalDegree(), order);
+		Interval<double> res = model.to_interval();
+		EXPECT_LT(res.diameter(), naive.diameter());
+		for (double vx = 0; vx <= 2; vx += 0.125) {
+			for (double vy = -1; vy <= 3; vy += 0.125) {
+				double value = vx*vx*vx*vy - vx*vy + vy*vy/3;
+				EXPECT_TRUE(res.contains(value)) << value << " not in " << res;
+			}
+		}
+	}
+
+	// Arithmetic on models encloses the result of the operations.
+	TaylorModel<Poly> mx(px, box, 2);
+	TaylorModel<Poly> my(py, box, 2);
+	TaylorModel<Poly> prod = mx * mx * my;
+	EXPECT_EQ(prod.expansion_point().size(), 2);
+	EXPECT_TRUE(prod.to_interval().contains(Interval<double>(-4.0, 12.0)));
+	Interval<double> sum = (mx * mx - mx * Rational(2)).to_interval();
+	EXPECT_EQ(sum, Interval<double>(-1.0, 0.0));
+
+	Interval<Rational>::evalintervalmap exact;
+	exact[x] = Interval<Rational>(0, 2);
+	EXPECT_EQ((TaylorModel<Poly, Rational>(p, exact, 2).to_interval()), Interval<Rational>(-1, 0));
+}
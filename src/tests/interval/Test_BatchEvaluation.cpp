@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include <carl/core/VariablePool.h>
+#include <carl/formula/Constraint.h>
+#include <carl/interval/BatchEvaluation.h>
+#include <carl/interval/Interval.h>
+#include <carl/interval/IntervalEvaluation.h>
+#include <carl/interval/evaluate.h>
+
+#include "../number_types.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+TEST(BatchEvaluation, Constraints)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	Poly px(x);
+	Poly py(y);
+	Poly pz(z);
+
+	BatchEvaluation<Poly> batch;
+	std::vector<Constraint<Poly>> constraints = {
+		Constraint<Poly>(px*px + py*py - Rational(1), Relation::LEQ),
+		Constraint<Poly>(px*px + py*py - Rational(4), Relation::GREATER),
+		Constraint<Poly>(px*py*pz + Rational(3)*px*px, Relation::EQ),
+		Constraint<Poly>(pz - Rational(1), Relation::GEQ),
+		Constraint<Poly>(px*py*pz - py, Relation::NEQ),
+	};
+	for (std::size_t i = 0; i < constraints.size(); ++i) {
+		EXPECT_EQ(batch.add(constraints[i]), i);
+	}
+	EXPECT_EQ(batch.size(), constraints.size());
+	// Variables, powers and monomials are shared between the constraints.
+	std::size_t separate = 0;
+	for (const auto& c: constraints) {
+		BatchEvaluation<Poly> single;
+		single.add(c);
+		separate += single.dag().size();
+	}
+	EXPECT_LT(batch.dag().size() + 8, separate);
+
+	IntervalBox<double> box;
+	box.insert_or_assign(x, Interval<double>(0.0, 0.5));
+	box.insert_or_assign(y, Interval<double>(-0.5, 0.5));
+	box.insert_or_assign(z, Interval<double>(2.0, 3.0));
+	auto result = batch.evaluate(box);
+	ASSERT_EQ(result.values.size(), constraints.size());
+	ASSERT_EQ(result.verdicts.size(), constraints.size());
+	for (std::size_t i = 0; i < constraints.size(); ++i) {
+		Interval<double> expected = IntervalEvaluation::evaluate(constraints[i].lhs(), box);
+		EXPECT_EQ(result.values[i], expected);
+		boost::tribool verdict = carl::evaluate(expected, constraints[i].relation());
+		EXPECT_TRUE(result.verdicts[i] == verdict || (boost::indeterminate(result.verdicts[i]) && boost::indeterminate(verdict)));
+	}
+	EXPECT_TRUE(result.verdicts[0]);
+	EXPECT_FALSE(result.verdicts[1]);
+	EXPECT_TRUE(boost::indeterminate(result.verdicts[2]));
+	EXPECT_TRUE(result.verdicts[3]);
+
+	// Results are reused.
+	box.insert_or_assign(z, Interval<double>(0.0));
+	std::vector<Interval<double>> values;
+	batch.evaluate(box, result, values);
+	EXPECT_FALSE(result.verdicts[3]);
+	EXPECT_EQ(result.values, batch.evaluate(box.to_map()).values);
+}
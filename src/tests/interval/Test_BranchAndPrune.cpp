@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+#include <carl/core/VariablePool.h>
+#include <carl/formula/Constraint.h>
+#include <carl/interval/BranchAndPrune.h>
+#include <carl/interval/Interval.h>
+
+#include "../number_types.h"
+
+#include <algorithm>
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+using Solver = BranchAndPrune<Poly>;
+
+TEST(BranchAndPrune, Equations)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+
+	// x^2 + y^2 = 1 and x = y
+	Constraints<Poly> constraints;
+	constraints.emplace(Poly({(Rational)1*x*x, (Rational)1*y*y, Term<Rational>(-1)}), Relation::EQ);
+	constraints.emplace(Poly({(Rational)1*x, (Rational)-1*y}), Relation::EQ);
+
+	IntervalBox<double> box;
+	box.insert_or_assign(x, Interval<double>(-2.0, 2.0));
+	box.insert_or_assign(y, Interval<double>(-2.0, 2.0));
+	for (auto split: {Solver::Split::LARGEST_WIDTH, Solver::Split::SMEAR}) {
+		Solver::Settings settings;
+		settings.split = split;
+		Solver solver(constraints, settings);
+		auto res = solver.solve(box);
+		ASSERT_EQ(res.answer, Solver::Answer::SAT);
+		double root = std::sqrt(0.5);
+		Interval<double> wx = res.witness->at(x);
+		EXPECT_TRUE(wx.contains(root) || wx.contains(-root)) << wx;
+		EXPECT_LT(wx.diameter(), 0.1);
+	}
+
+	// Without interval Newton, only enclosures of the solutions are found.
+	Solver::Settings settings;
+	settings.use_newton = false;
+	settings.precision = 1e-3;
+	auto res = Solver(constraints, settings).solve(box);
+	EXPECT_EQ(res.answer, Solver::Answer::UNKNOWN);
+	EXPECT_FALSE(res.undecided.empty());
+	for (const auto& b: res.undecided) {
+		EXPECT_LE(b.at(x).diameter(), 1e-3);
+		EXPECT_LT(std::abs(std::abs(carl::center(b.at(x))) - std::sqrt(0.5)), 1e-2);
+	}
+}
+
+TEST(BranchAndPrune, MixedInteger)
+{
+	Variable x = freshIntegerVariable("x");
+	Variable y = freshRealVariable("y");
+	IntervalBox<double> box;
+	box.insert_or_assign(x, Interval<double>(-4.0, 4.0));
+	box.insert_or_assign(y, Interval<double>(-4.0, 4.0));
+
+	// x^2 y + y = 1 and x y + x^2 - y^2 = 1 only have non-integer solutions, e.g. x = -1.2767...
+	// HC4 does not prune the boxes around them, and the interval Newton operator proves that they contain a unique real solution.
+	// Rounding the contracted intervals of x to integers prunes these boxes.
+	Constraints<Poly> constraints;
+	constraints.emplace(Poly({(Rational)1*x*x*y, (Rational)1*y, Term<Rational>(-1)}), Relation::EQ);
+	constraints.emplace(Poly({(Rational)1*x*y, (Rational)1*x*x, (Rational)-1*y*y, Term<Rational>(-1)}), Relation::EQ);
+	for (auto split: {Solver::Split::LARGEST_WIDTH, Solver::Split::SMEAR}) {
+		Solver::Settings settings;
+		settings.split = split;
+		auto res = Solver(constraints, settings).solve(box);
+		EXPECT_EQ(res.answer, Solver::Answer::UNSAT);
+	}
+
+	// x^2 + y^2 = 2 and x = y have the integer solutions x = y = +-1.
+	constraints.clear();
+	constraints.emplace(Poly({(Rational)1*x*x, (Rational)1*y*y, Term<Rational>(-2)}), Relation::EQ);
+	constraints.emplace(Poly({(Rational)1*x, (Rational)-1*y}), Relation::EQ);
+	auto res = Solver(constraints).solve(box);
+	ASSERT_EQ(res.answer, Solver::Answer::SAT);
+	const auto& wx = res.witness->at(x);
+	EXPECT_TRUE(wx.isPointInterval());
+	EXPECT_EQ(std::abs(wx.lower()), 1.0);
+}
+
+TEST(BranchAndPrune, Inequalities)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable n = freshIntegerVariable("n");
+
+	// x^2 + y^2 < 1 and x + y >= 3 is unsatisfiable.
+	Constraints<Poly> unsat;
+	unsat.emplace(Poly({(Rational)1*x*x, (Rational)1*y*y, Term<Rational>(-1)}), Relation::LESS);
+	unsat.emplace(Poly({(Rational)1*x, (Rational)1*y, Term<Rational>(-3)}), Relation::GEQ);
+	auto res = Solver(unsat).solve(IntervalBox<double>());
+	EXPECT_EQ(res.answer, Solver::Answer::UNSAT);
+	EXPECT_TRUE(res.undecided.empty());
+
+	// x^2 + y^2 < 1 and x*n > 1/2 with 0 < n < 5 has solutions.
+	Constraints<Poly> sat;
+	sat.emplace(Poly({(Rational)1*x*x, (Rational)1*y*y, Term<Rational>(-1)}), Relation::LESS);
+	sat.emplace(Poly({(Rational)2*x*n, Term<Rational>(-1)}), Relation::GREATER);
+	sat.emplace(Poly({(Rational)1*n}), Relation::GREATER);
+	sat.emplace(Poly({(Rational)1*n, Term<Rational>(-5)}), Relation::LESS);
+	res = Solver(sat).solve(IntervalBox<double>());
+	ASSERT_EQ(res.answer, Solver::Answer::SAT);
+	for (const auto& c: sat) {
+		EXPECT_TRUE(bool(carl::evaluate(IntervalEvaluation::evaluate(c.lhs(), *res.witness), c.relation())));
+	}
+
+	// The search stops after the given number of boxes.
+	Solver::Settings settings;
+	settings.max_boxes = 3;
+	settings.stop_on_witness = false;
+	res = Solver(sat, settings).solve(IntervalBox<double>());
+	EXPECT_EQ(res.statistics.boxes, 3);
+	EXPECT_FALSE(res.undecided.empty());
+}
+
+TEST(BranchAndPrune, Threads)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+
+	// x^2 = 2 and y^2 = 3 have four solutions, which are enclosed by undecided boxes.
+	Constraints<Poly> constraints;
+	constraints.emplace(Poly({(Rational)1*x*x, Term<Rational>(-2)}), Relation::EQ);
+	constraints.emplace(Poly({(Rational)1*y*y, Term<Rational>(-3)}), Relation::EQ);
+	IntervalBox<double> box;
+	box.insert_or_assign(x, Interval<double>(-4.0, 4.0));
+	box.insert_or_assign(y, Interval<double>(-4.0, 4.0));
+
+	auto centers = [x, y](const Solver::Result& res) {
+		std::vector<std::pair<double, double>> c;
+		for (const auto& b: res.undecided) {
+			c.emplace_back(carl::center(b.at(x)), carl::center(b.at(y)));
+		}
+		std::sort(c.begin(), c.end());
+		return c;
+	};
+
+	Solver::Settings settings;
+	settings.use_newton = false;
+	settings.stop_on_witness = false;
+	settings.precision = 1e-4;
+	auto single = Solver(constraints, settings).solve(box);
+	EXPECT_EQ(single.answer, Solver::Answer::UNKNOWN);
+	EXPECT_GE(single.undecided.size(), 4);
+	EXPECT_EQ(single.statistics.steals, 0);
+	// The single threaded search is deterministic.
+	auto again = Solver(constraints, settings).solve(box);
+	EXPECT_EQ(again.statistics.boxes, single.statistics.boxes);
+	EXPECT_EQ(centers(again), centers(single));
+
+	settings.threads = 4;
+	auto parallel = Solver(constraints, settings).solve(box);
+	EXPECT_EQ(parallel.answer, Solver::Answer::UNKNOWN);
+	EXPECT_EQ(parallel.statistics.boxes, single.statistics.boxes);
+	EXPECT_EQ(centers(parallel), centers(single));
+
+	settings.use_newton = true;
+	settings.stop_on_witness = true;
+	auto witness = Solver(constraints, settings).solve(box);
+	ASSERT_EQ(witness.answer, Solver::Answer::SAT);
+	EXPECT_TRUE(witness.witness->at(x).contains(std::sqrt(2.0)) || witness.witness->at(x).contains(-std::sqrt(2.0)));
+}
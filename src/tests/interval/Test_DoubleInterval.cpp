@@ -12,7 +12,10 @@
 #include "gtest/gtest.h"
 #include "carl/interval/Interval.h"
 #include "carl/interval/set_theory.h"
+#include "carl/interval/power.h"
 #include "carl/core/VariablePool.h"
+#include <cfenv>
+#include <cmath>
 #include <iostream>
 #include "carl/util/platform.h"
 
@@ -1322,3 +1325,25 @@ TEST(DoubleInterval, BloatShrink)
     i4.shrink_by(2);
     EXPECT_EQ(result4, i4);
 }
+
+TEST(DoubleInterval, Rounding)
+{
+    // Exact operations yield point intervals.
+    EXPECT_EQ(DoubleInterval(0.5) + DoubleInterval(0.25), DoubleInterval(0.75));
+    EXPECT_EQ(DoubleInterval(3) * DoubleInterval(0.125), DoubleInterval(0.375));
+    EXPECT_EQ(carl::sqrt(DoubleInterval(9)), DoubleInterval(3));
+
+    // Inexact operations are rounded outwards by exactly one ulp.
+    DoubleInterval sum = DoubleInterval(0.1) + DoubleInterval(0.2);
+    EXPECT_EQ(std::nextafter(sum.lower(), 1.0), sum.upper());
+    EXPECT_TRUE(sum.lower() < 0.1 + 0.2 || sum.upper() > 0.1 + 0.2);
+    DoubleInterval product = DoubleInterval(0.1) * DoubleInterval(3);
+    EXPECT_EQ(std::nextafter(product.lower(), 1.0), product.upper());
+    DoubleInterval root = carl::sqrt(DoubleInterval(2));
+    EXPECT_EQ(std::nextafter(root.lower(), 2.0), root.upper());
+    EXPECT_LE(root.lower() * root.lower(), 2.0);
+    EXPECT_GE(root.upper() * root.upper(), 2.0);
+
+    // The rounding mode of the floating point unit is left untouched.
+    EXPECT_EQ(std::fegetround(), FE_TONEAREST);
+}
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <carl/interval/Interval.h>
+#include <carl/core/VariablePool.h>
+#include <carl/formula/Constraint.h>
+#include <carl/interval/HC4.h>
+
+#include "../number_types.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+TEST(HC4, Circle)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+
+	// x^2 + y^2 <= 1 and x >= 1/2
+	Constraints<Poly> constraints;
+	constraints.emplace(Poly({(Rational)1*x*x, (Rational)1*y*y, Term<Rational>(-1)}), Relation::LEQ);
+	constraints.emplace(Poly({(Rational)2*x, Term<Rational>(-1)}), Relation::GEQ);
+	contractor::HC4<Poly> hc4(constraints);
+
+	IntervalBox<double> box;
+	box.insert_or_assign(x, Interval<double>(-10, 10));
+	box.insert_or_assign(y, Interval<double>(-10, 10));
+	EXPECT_TRUE(hc4.contract(box));
+	EXPECT_TRUE(Interval<double>(0.5, 1.0).contains(box[x]));
+	EXPECT_TRUE(box[x].contains(Interval<double>(0.5, 1.0)));
+	EXPECT_TRUE(Interval<double>(-0.87, 0.87).contains(box[y]));
+	EXPECT_TRUE(box[y].contains(Interval<double>(-0.86, 0.86)));
+	for (std::size_t i = 0; i < hc4.size(); ++i) {
+		EXPECT_GT(hc4.statistics(i).revisions, 0);
+		EXPECT_EQ(hc4.statistics(i).conflicts, 0);
+	}
+
+	// Outside of the circle
+	IntervalBox<double> outside;
+	outside.insert_or_assign(x, Interval<double>(2, 3));
+	EXPECT_FALSE(hc4.contract(outside));
+}
+
+TEST(HC4, Propagation)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshIntegerVariable("z");
+
+	// x*y = 1, x*y + z >= 0, z - x <= 0, x^3 <= 27
+	Constraints<Poly> constraints;
+	constraints.emplace(Poly({(Rational)1*x*y, Term<Rational>(-1)}), Relation::EQ);
+	constraints.emplace(Poly({(Rational)1*x*y, (Rational)1*z}), Relation::GEQ);
+	constraints.emplace(Poly({(Rational)1*z, (Rational)-1*x}), Relation::LEQ);
+	constraints.emplace(Poly({(Rational)1*x*x*x, Term<Rational>(-27)}), Relation::LEQ);
+	contractor::HC4<Poly> hc4(constraints);
+	// x, y, z, x*y, x^3 and the sums x*y, x*y + z, z - x, x^3
+	EXPECT_EQ(hc4.dag().size(), 9);
+
+	std::map<Variable, Interval<double>> map;
+	map[x] = Interval<double>(0.5, 100.0);
+	map[z] = Interval<double>(0, 100);
+	EXPECT_TRUE(hc4.contract(map));
+	EXPECT_EQ(map.size(), 3);
+	EXPECT_TRUE(map[x].contains(Interval<double>(0.5, 3.0)));
+	EXPECT_TRUE(Interval<double>(0.49, 3.01).contains(map[x]));
+	EXPECT_TRUE(Interval<double>(0.33, 2.01).contains(map[y]));
+	EXPECT_EQ(map[z], Interval<double>(0, 3));
+}
+
+TEST(HC4, Powers)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+
+	// x^3 + 8 = 0, y^2 - 4 = 0, y - x <= 0
+	Constraints<Poly> constraints;
+	constraints.emplace(Poly({(Rational)1*x*x*x, Term<Rational>(8)}), Relation::EQ);
+	constraints.emplace(Poly({(Rational)1*y*y, Term<Rational>(-4)}), Relation::EQ);
+	constraints.emplace(Poly({(Rational)1*y, (Rational)-1*x}), Relation::LEQ);
+	contractor::HC4<Poly> hc4(constraints);
+
+	IntervalBox<double> box;
+	box.insert_or_assign(x, Interval<double>(-10, 10));
+	box.insert_or_assign(y, Interval<double>(-10, 10));
+	EXPECT_TRUE(hc4.contract(box));
+	EXPECT_TRUE(box[x].contains(-2.0));
+	EXPECT_LT(box[x].diameter(), 1e-10);
+	EXPECT_TRUE(box[y].contains(-2.0));
+	EXPECT_LT(box[y].diameter(), 1e-10);
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <carl/core/MultivariateHornerCache.h>
+#include <carl/core/VariablePool.h>
+#include <carl/interval/Interval.h>
+#include <carl/interval/IntervalBox.h>
+#include <carl/interval/IntervalEvaluation.h>
+
+#include "../number_types.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+namespace {
+struct IntervalStrategy: public strategy {
+	static constexpr variableSelectionHeurisics selectionType = GREEDY_II;
+};
+}
+
+TEST(MultivariateHornerCache, Shared)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Poly p = Poly(x)*Poly(y) + Rational(2)*Poly(x) + Poly(x)*Poly(x)*Poly(y);
+
+	auto& cache = MultivariateHornerCache<Poly, strategy>::getInstance();
+	cache.clear();
+	std::size_t builds = cache.builds();
+	auto scheme = cache.get(p);
+	EXPECT_EQ(cache.get(p), scheme);
+	EXPECT_EQ(cache.size(), 1);
+	EXPECT_EQ(cache.builds(), builds + 1);
+
+	IntervalBox<double> box;
+	box.insert_or_assign(x, Interval<double>(-1.0, 2.0));
+	box.insert_or_assign(y, Interval<double>(0.0, 1.0));
+	// Schemes do not depend on the intervals for this strategy.
+	EXPECT_EQ(cache.get(p, box), scheme);
+	Interval<double> res = IntervalEvaluation::evaluate(*scheme, box);
+	EXPECT_EQ(res, IntervalEvaluation::evaluate(*scheme, box.to_map()));
+	EXPECT_TRUE(res.contains(IntervalEvaluation::evaluate(p, IntervalBox<double>(std::map<Variable, Interval<double>>({{x, Interval<double>(1)}, {y, Interval<double>(1)}})))));
+}
+
+TEST(MultivariateHornerCache, Widths)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Poly p = Poly(x)*Poly(y) + Poly(x)*Poly(x) + Poly(y)*Poly(y)*Poly(x);
+
+	auto& cache = MultivariateHornerCache<Poly, IntervalStrategy>::getInstance();
+	cache.clear();
+	cache.setThreshold(2);
+	std::size_t builds = cache.builds();
+
+	IntervalBox<double> box;
+	box.insert_or_assign(x, Interval<double>(0.0, 1.0));
+	box.insert_or_assign(y, Interval<double>(0.0, 1.0));
+	auto scheme = cache.get(p, box);
+	EXPECT_EQ(cache.builds(), builds + 1);
+
+	// Small changes and point intervals do not trigger a rebuild.
+	box.insert_or_assign(x, Interval<double>(0.0, 0.75));
+	EXPECT_EQ(cache.get(p, box), scheme);
+	box.insert_or_assign(y, Interval<double>(0.5));
+	EXPECT_EQ(cache.get(p, box), scheme);
+	EXPECT_EQ(cache.builds(), builds + 1);
+
+	// Significant changes do.
+	box.insert_or_assign(x, Interval<double>(0.0, 0.25));
+	auto rebuilt = cache.get(p, box);
+	EXPECT_NE(rebuilt, scheme);
+	EXPECT_EQ(cache.builds(), builds + 2);
+	EXPECT_EQ(cache.size(), 1);
+
+	// The old scheme is still valid.
+	box.insert_or_assign(y, Interval<double>(0.0, 1.0));
+	EXPECT_TRUE(IntervalEvaluation::evaluate(*scheme, box).contains(Interval<double>(0.0)));
+	EXPECT_TRUE(IntervalEvaluation::evaluate(*rebuilt, box).contains(Interval<double>(0.0)));
+
+	box.insert_or_assign(x, Interval<double>::unboundedInterval());
+	EXPECT_NE(cache.get(p, box), nullptr);
+}
+
+TEST(MultivariateHornerCache, Eviction)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Poly p = Poly(x)*Poly(y) + Poly(x);
+	Poly q = Poly(x)*Poly(x)*Poly(y) + Poly(y);
+	Poly r = Poly(y)*Poly(y)*Poly(x) + Poly(x)*Poly(y);
+
+	MultivariateHornerCache<Poly, strategy> cache;
+	cache.setMaxSize(2);
+	auto scheme = cache.get(p);
+	cache.get(q);
+	EXPECT_EQ(cache.get(p), scheme);
+	// q is the least recently used scheme.
+	cache.get(r);
+	EXPECT_EQ(cache.size(), 2);
+	EXPECT_EQ(cache.builds(), 3);
+	EXPECT_EQ(cache.get(p), scheme);
+	EXPECT_EQ(cache.builds(), 3);
+	cache.get(q);
+	EXPECT_EQ(cache.builds(), 4);
+
+	cache.setMaxSize(1);
+	EXPECT_EQ(cache.size(), 1);
+	EXPECT_NE(cache.get(p), scheme);
+	EXPECT_EQ(cache.builds(), 5);
+}
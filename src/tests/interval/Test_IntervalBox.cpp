@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include <carl/interval/Interval.h>
+#include <carl/interval/IntervalBox.h>
+#include <carl/core/VariablePool.h>
+#include <carl/interval/IntervalEvaluation.h>
+#include <carl/interval/Contraction.h>
+#include <carl/interval/Contractor.h>
+
+#include "../number_types.h"
+
+using namespace carl;
+
+TEST(IntervalBox, Basic)
+{
+	Variable a = freshRealVariable("a");
+	Variable b = freshIntegerVariable("b");
+	Variable c = freshRealVariable("c");
+
+	IntervalBox<double> box;
+	EXPECT_TRUE(box.empty());
+	box.insert_or_assign(a, Interval<double>(1, 2));
+	box.insert_or_assign(b, Interval<double>(-3, 3));
+	EXPECT_EQ(box.size(), 2);
+	EXPECT_EQ(box.count(a), 1);
+	EXPECT_EQ(box.count(c), 0);
+	EXPECT_EQ(box[a], Interval<double>(1, 2));
+	EXPECT_EQ(box.at(b), Interval<double>(-3, 3));
+	EXPECT_THROW(box.at(c), std::out_of_range);
+
+	// Copies share their intervals until one of them is modified.
+	IntervalBox<double> snapshot = box;
+	EXPECT_EQ(snapshot, box);
+	box.insert_or_assign(a, Interval<double>(1.0, 1.5));
+	EXPECT_EQ(snapshot[a], Interval<double>(1, 2));
+	EXPECT_EQ(box[a], Interval<double>(1.0, 1.5));
+	EXPECT_NE(snapshot, box);
+
+	EXPECT_EQ(box.erase(b), 1);
+	EXPECT_EQ(box.erase(b), 0);
+	EXPECT_EQ(box.size(), 1);
+	EXPECT_EQ(snapshot.size(), 2);
+
+	auto map = snapshot.to_map();
+	EXPECT_EQ(map.size(), 2);
+	EXPECT_EQ(IntervalBox<double>(map), snapshot);
+}
+
+TEST(IntervalBox, Evaluation)
+{
+	Variable a = freshRealVariable("a");
+	Variable b = freshRealVariable("b");
+	Variable c = freshRealVariable("c");
+	Variable d = freshRealVariable("d");
+
+	Interval<double>::evalintervalmap map;
+	map[a] = Interval<double>(1, 4);
+	map[b] = Interval<double>(2, 5);
+	map[c] = Interval<double>(-2, 3);
+	map[d] = Interval<double>(0, 2);
+	IntervalBox<double> box(map);
+
+	MultivariatePolynomial<Rational> e1({(Rational)1*a*b,(Rational)1*c*d});
+	MultivariatePolynomial<Rational> e2({(Rational)12*a,(Rational)3*b, (Rational)1*c*c,(Rational)-1*d*d*d});
+	MultivariatePolynomial<Rational> e3({a,c});
+	e3 = carl::pow(e3, 2)*b*d+a;
+
+	for (const auto& p: {e1, e2, e3}) {
+		EXPECT_EQ(IntervalEvaluation::evaluate(p, map), IntervalEvaluation::evaluate(p, box));
+		for (auto v: {a, b, c, d}) {
+			if (!p.has(v)) continue;
+			contractor::Evaluation<MultivariatePolynomial<Rational>> eval(p, v);
+			EXPECT_EQ(eval.evaluate(map), eval.evaluate(box));
+
+			Contraction<SimpleNewton, MultivariatePolynomial<Rational>> contraction(p);
+			Interval<double> resA, resB, boxA, boxB;
+			EXPECT_EQ(contraction(map, v, resA, resB), contraction(box, v, boxA, boxB));
+			EXPECT_EQ(resA, boxA);
+			EXPECT_EQ(resB, boxB);
+		}
+	}
+}
@@ -84,4 +84,21 @@ TEST(IntervalEvaluation, Term)
 
 TEST(IntervalEvaluation, MultivariatePolynomial)
 {
+    Variable a = freshRealVariable("a");
+    Variable b = freshRealVariable("b");
+    std::map<Variable, Interval<double>> map;
+    map[a] = Interval<double>(-1.0, 2.0);
+    map[b] = Interval<double>(-3.0, BoundType::STRICT, -1.0, BoundType::WEAK);
+
+    // Powers shared between terms evaluate like separate powers.
+    MultivariatePolynomial<Rational> p({(Rational)1*a*a*b, (Rational)-2*a*a, (Rational)3*a*a*a*b*b, (Rational)1*b*b});
+    Interval<double> expected(0.0);
+    for (const auto& t: p) {
+        expected += IntervalEvaluation::evaluate(t, map);
+    }
+    EXPECT_EQ(expected, IntervalEvaluation::evaluate(p, map));
+
+    // a^2 b is zero for a = 0, hence the term a^2 b ranges over (-12, 0].
+    MultivariatePolynomial<Rational> q({(Rational)1*a*a*b});
+    EXPECT_EQ(Interval<double>(-12.0, BoundType::STRICT, 0.0, BoundType::WEAK), IntervalEvaluation::evaluate(q, map));
 }
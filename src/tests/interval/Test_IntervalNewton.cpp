@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include <carl/interval/Interval.h>
+#include <carl/core/VariablePool.h>
+#include <carl/interval/IntervalNewton.h>
+
+#include "../number_types.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+TEST(IntervalNewton, Circle)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+
+	// x^2 + y^2 - 1 = 0, x - y = 0
+	std::vector<Poly> equations({
+		Poly({(Rational)1*x*x, (Rational)1*y*y, Term<Rational>(-1)}),
+		Poly({(Rational)1*x, (Rational)-1*y})
+	});
+	double solution = std::sqrt(0.5);
+
+	for (auto method: {contractor::IntervalNewton<Poly>::Method::HANSEN_SENGUPTA, contractor::IntervalNewton<Poly>::Method::KRAWCZYK}) {
+		contractor::IntervalNewton<Poly> newton(equations, {x, y}, method);
+		IntervalBox<double> box;
+		box.insert_or_assign(x, Interval<double>(0.5, 1.0));
+		box.insert_or_assign(y, Interval<double>(0.5, 1.0));
+		EXPECT_TRUE(newton.contract(box));
+		EXPECT_TRUE(newton.unique_solution());
+		EXPECT_TRUE(box[x].contains(solution));
+		EXPECT_TRUE(box[y].contains(solution));
+		EXPECT_LT(box[x].diameter(), 1e-12);
+		EXPECT_LT(box[y].diameter(), 1e-12);
+
+		// No solution in this box
+		IntervalBox<double> empty;
+		empty.insert_or_assign(x, Interval<double>(0.8, 1.0));
+		empty.insert_or_assign(y, Interval<double>(0.0, 0.1));
+		EXPECT_FALSE(newton.contract(empty));
+	}
+}
+
+TEST(IntervalNewton, Singular)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+
+	// x^2 - y = 0, x + y - 2 = 0 with solutions (1, 1) and (-2, 4)
+	std::vector<Poly> equations({
+		Poly({(Rational)1*x*x, (Rational)-1*y}),
+		Poly({(Rational)1*x, (Rational)1*y, Term<Rational>(-2)})
+	});
+	contractor::IntervalNewton<Poly> newton(equations, {x, y});
+
+	// Both solutions are contained, the box must not lose any of them.
+	std::map<Variable, Interval<double>> map;
+	map[x] = Interval<double>(-3, 2);
+	map[y] = Interval<double>(0, 5);
+	EXPECT_TRUE(newton.contract(map));
+	EXPECT_FALSE(newton.unique_solution());
+	EXPECT_TRUE(map[x].contains(1.0) && map[x].contains(-2.0));
+	EXPECT_TRUE(map[y].contains(1.0) && map[y].contains(4.0));
+}
@@ -18,6 +18,24 @@ TEST(Interval, pow) {
 	EXPECT_RESULT_E(carl::pow, 4.0, 2, 16.0);
 	EXPECT_RESULT_E(carl::pow, 5.0, 2, 25.0);
 	EXPECT_RESULT_E(carl::pow, 6.0, 2, 36.0);
+
+	using carl::BoundType;
+	EXPECT_EQ(I(1.0, 9.0), carl::pow(I(-3.0, -1.0), 2u));
+	EXPECT_EQ(I(-27.0, -1.0), carl::pow(I(-3.0, -1.0), 3u));
+	EXPECT_EQ(I(0.0, 16.0), carl::pow(I(-2.0, 4.0), 2u));
+	EXPECT_EQ(I(-8.0, 64.0), carl::pow(I(-2.0, 4.0), 3u));
+	EXPECT_EQ(I(0.0, BoundType::STRICT, 4.0, BoundType::WEAK), carl::pow(I(-2.0, BoundType::WEAK, 0.0, BoundType::STRICT), 2u));
+	EXPECT_EQ(I(0.0, BoundType::WEAK, 4.0, BoundType::STRICT), carl::pow(I(-2.0, BoundType::STRICT, 1.0, BoundType::WEAK), 2u));
+	EXPECT_EQ(I(0.0, BoundType::WEAK, 4.0, BoundType::WEAK), carl::pow(I(-2.0, BoundType::STRICT, 2.0, BoundType::WEAK), 2u));
+	EXPECT_EQ(I(-8.0, BoundType::STRICT, 8.0, BoundType::WEAK), carl::pow(I(-2.0, BoundType::STRICT, 2.0, BoundType::WEAK), 3u));
+	EXPECT_EQ(I(1.0), carl::pow(I(-2.0, 3.0), 0u));
+	EXPECT_EQ(I(0.0, BoundType::WEAK, 0.0, BoundType::INFTY), carl::pow(I(-2.0, BoundType::WEAK, 0.0, BoundType::INFTY), 2u));
+
+	// (1 + 2^-30)^4 = 1 + 2^-28 + 6*2^-60 + 4*2^-90 + 2^-120 is not a double and is enclosed by neighbouring doubles.
+	I inexact = carl::pow(I(1.0 + 0x1p-30), 4u);
+	EXPECT_GE(inexact.lower(), 1.0 + 0x1p-28);
+	EXPECT_LE(inexact.upper(), 1.0 + 0x1p-28 + 0x1p-50);
+	EXPECT_LT(inexact.lower(), inexact.upper());
 }
 
 TEST(Interval, sqrt) {
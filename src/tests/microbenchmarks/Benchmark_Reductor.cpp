@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/groebner/groebner.h>
+#include <carl/groebner/benchmarks/cyclic.h>
+#include <carl/groebner/benchmarks/katsura.h>
+
+/**
+ * Compares the data structures available for the Reductor.
+ * For every workload we compute a Groebner basis once and reduce the pairwise products of the input polynomials.
+ * The first argument selects the workload: 0 is cyclic, 1 is katsura. The second argument is its size.
+ */
+
+using Poly = carl::MultivariatePolynomial<mpq_class>;
+
+struct ReductorWorkload {
+	carl::Ideal<Poly> ideal;
+	std::vector<Poly> polys;
+};
+
+const ReductorWorkload& reductor_workload(std::int64_t type, std::int64_t index) {
+	static std::map<std::pair<std::int64_t,std::int64_t>, ReductorWorkload> cache;
+	auto it = cache.find(std::make_pair(type, index));
+	if (it != cache.end()) return it->second;
+
+	std::vector<Poly> input;
+	if (type == 0) {
+		input = carl::benchmarks::cyclic<mpq_class, carl::GrLexOrdering, carl::StdMultivariatePolynomialPolicies<>>(unsigned(index));
+	} else {
+		input = carl::benchmarks::katsura<mpq_class, carl::GrLexOrdering, carl::StdMultivariatePolynomialPolicies<>>(unsigned(index));
+	}
+	carl::GBProcedure<Poly, carl::Buchberger, carl::StdAdding> gb;
+	for (const auto& p: input) gb.addPolynomial(p.normalize());
+	gb.calculate();
+
+	std::vector<Poly> polys;
+	for (const auto& p: input) {
+		for (const auto& q: input) {
+			polys.emplace_back(p * q);
+		}
+	}
+	return cache.emplace(std::make_pair(type, index), ReductorWorkload{gb.getIdeal(), std::move(polys)}).first->second;
+}
+
+template<template <class> class Datastructure, template <typename> class Configuration>
+void BM_Reductor(benchmark::State& state) {
+	const ReductorWorkload& w = reductor_workload(state.range(0), state.range(1));
+	for (auto _ : state) {
+		for (const auto& p: w.polys) {
+			carl::Reductor<Poly, Poly, Datastructure, Configuration> reductor(w.ideal, p);
+			benchmark::DoNotOptimize(reductor.fullReduce());
+		}
+	}
+}
+
+static void ReductorWorkloads(benchmark::internal::Benchmark* b) {
+	b->Args({0, 2})->Args({0, 3});
+	for (std::int64_t i = 2; i <= 5; ++i) b->Args({1, i});
+}
+
+BENCHMARK_TEMPLATE(BM_Reductor, carl::Heap, carl::ReductorConfiguration)->Apply(ReductorWorkloads);
+BENCHMARK_TEMPLATE(BM_Reductor, carl::Geobucket, carl::ReductorConfiguration)->Apply(ReductorWorkloads);
+BENCHMARK_TEMPLATE(BM_Reductor, carl::Geobucket, carl::DeduplicatingReductorConfiguration)->Apply(ReductorWorkloads);
+BENCHMARK_TEMPLATE(BM_Reductor, carl::TourTree, carl::ReductorConfiguration)->Apply(ReductorWorkloads);
+BENCHMARK_TEMPLATE(BM_Reductor, carl::TourTree, carl::DeduplicatingReductorConfiguration)->Apply(ReductorWorkloads);
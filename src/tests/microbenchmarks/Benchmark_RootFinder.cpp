@@ -1,8 +1,11 @@
 #include <benchmark/benchmark.h>
 
 #include <carl/ran/real_roots.h>
+#include <carl/core/polynomialfunctions/Chebyshev.h>
 //#include <carl/ran/ran.h>
 
+#include <sstream>
+
 using Poly = carl::UnivariatePolynomial<mpq_class>;
 
 class RF_Fixture: public benchmark::Fixture {	
@@ -46,3 +49,55 @@ BENCHMARK_F(RF_Fixture, Real_Roots_2)(benchmark::State& state) {
 
 
 
+/// Polynomials with many roots (Chebyshev, Wilkinson) or with a cluster of roots (Mignotte).
+enum class RootFinderFamily { Chebyshev, Wilkinson, Mignotte };
+
+Poly root_finder_workload(RootFinderFamily family, std::size_t degree) {
+	carl::Variable x = carl::freshRealVariable("x");
+	switch (family) {
+		case RootFinderFamily::Chebyshev:
+			return carl::Chebyshev<mpq_class>(x)(degree);
+		case RootFinderFamily::Wilkinson: {
+			Poly p(x, {1});
+			for (std::size_t i = 1; i <= degree; ++i) p *= Poly(x, {-mpq_class(i), 1});
+			return p;
+		}
+		case RootFinderFamily::Mignotte: {
+			// x^d - 2 (50x - 1)^2 has two roots closely around 1/50.
+			Poly p = Poly(x, {-1, 50});
+			p = p * p * mpq_class(-2);
+			p += Poly(x, mpq_class(1), degree);
+			return p;
+		}
+	}
+	return Poly(x);
+}
+
+/**
+ * Compares the root isolation methods on polynomials with many or clustered roots.
+ * The argument is the degree, the second one the carl::ran::RootIsolationMethod.
+ */
+template<RootFinderFamily Family>
+void BM_RealRootsMethod(benchmark::State& state) {
+	Poly p = root_finder_workload(Family, std::size_t(state.range(0)));
+	auto method = carl::ran::RootIsolationMethod(state.range(1));
+	std::size_t roots = 0;
+	for (auto _ : state) {
+		roots = carl::real_roots(p, carl::Interval<mpq_class>::unboundedInterval(), method).roots().size();
+	}
+	state.counters["roots"] = double(roots);
+	std::stringstream ss;
+	ss << method;
+	state.SetLabel(ss.str());
+}
+
+void RootFinderMethods(benchmark::internal::Benchmark* b) {
+	b->ArgNames({"degree", "method"});
+	for (int method = int(carl::ran::RootIsolationMethod::BISECTION); method <= int(carl::ran::RootIsolationMethod::CONTINUED_FRACTIONS); ++method) {
+		for (int degree: {10, 20, 40, 80}) b->Args({degree, method});
+	}
+}
+
+BENCHMARK_TEMPLATE(BM_RealRootsMethod, RootFinderFamily::Chebyshev)->Apply(RootFinderMethods)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_RealRootsMethod, RootFinderFamily::Wilkinson)->Apply(RootFinderMethods)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_RealRootsMethod, RootFinderFamily::Mignotte)->Apply(RootFinderMethods)->Unit(benchmark::kMillisecond);
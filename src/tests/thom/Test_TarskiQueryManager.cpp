@@ -0,0 +1,83 @@
+#include "gtest/gtest.h"
+#include "carl/ran/thom/SignDetermination/SignDetermination.h"
+#include "carl/ran/thom/TarskiQuery/TarskiQueryManager.h"
+
+#include "../Common.h"
+
+#include <vector>
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+namespace {
+	void checkBatch(const TarskiQueryManager<Rational>& taq, const std::vector<Poly>& polys, const std::vector<int>& expected) {
+		for (std::size_t threads: {1, 2, 4}) {
+			EXPECT_EQ(expected, taq(polys, threads)) << "with " << threads << " threads";
+		}
+		std::vector<int> sequential;
+		for (const auto& p: polys) sequential.push_back(taq(p));
+		EXPECT_EQ(expected, sequential);
+	}
+}
+
+TEST(TarskiQueryManager, Univariate)
+{
+	Variable x = freshRealVariable("x");
+	std::vector<Poly> zeroSet({Poly(x)*x - Rational(2)});
+	TarskiQueryManager<Rational> taq(zeroSet.begin(), zeroSet.end());
+	EXPECT_EQ(2, taq(Rational(1)));
+
+	std::vector<Poly> polys({
+		Poly(Rational(1)), Poly(x), Poly(x) - Rational(1),
+		Poly(x) + Rational(2), Poly(x)*x, Poly(x)*x - Rational(2)
+	});
+	std::vector<int> expected({2, 0, 0, 2, 2, 0});
+	checkBatch(taq, polys, expected);
+
+	// a copy and a manager on the same zero set share the cached queries
+	TarskiQueryManager<Rational> copy(taq);
+	checkBatch(copy, polys, expected);
+	TarskiQueryManager<Rational> other(zeroSet.begin(), zeroSet.end());
+	checkBatch(other, polys, expected);
+}
+
+TEST(TarskiQueryManager, Multivariate)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	std::vector<Poly> zeroSet({Poly(x)*x - Rational(2), Poly(y)*y - Rational(3)});
+	TarskiQueryManager<Rational> taq(zeroSet.begin(), zeroSet.end());
+	EXPECT_EQ(4, taq(Rational(1)));
+
+	std::vector<Poly> polys({
+		Poly(Rational(1)), Poly(x), Poly(x)*y, Poly(x) - Poly(y),
+		Poly(y) - Rational(1), Poly(x) + Poly(y) + Rational(4), Poly(x)*x - Rational(2)
+	});
+	std::vector<int> expected({4, 0, 0, 0, 0, 4, 0});
+	checkBatch(taq, polys, expected);
+
+	TarskiQueryManager<Rational> copy(taq);
+	checkBatch(copy, polys, expected);
+}
+
+TEST(TarskiQueryManager, SignDetermination)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	std::vector<Poly> zeroSet({Poly(x)*x - Rational(2), Poly(y)*y - Rational(3)});
+	std::vector<Poly> polys({Poly(x), Poly(y) - Rational(1), Poly(x) - Poly(y)});
+
+	SignDetermination<Rational> sd(zeroSet.begin(), zeroSet.end());
+	EXPECT_EQ(4, sd.sizeOfZeroSet());
+	sd.getSignsAndAdd(polys[0]);
+	SignDetermination<Rational> copy(sd);
+	auto signs = sd.getSignsAndAddAll(polys.begin() + 1, polys.end());
+	auto copySigns = copy.getSignsAndAddAll(polys.begin() + 1, polys.end());
+	EXPECT_EQ(4, signs.size());
+	EXPECT_EQ(signs, copySigns);
+
+	// a fresh sign determination on the same zero set reuses the registered data
+	SignDetermination<Rational> fresh(zeroSet.begin(), zeroSet.end());
+	EXPECT_EQ(signs, fresh.getSignsAndAddAll(polys.begin(), polys.end()));
+}